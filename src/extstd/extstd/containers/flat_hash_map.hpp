@@ -0,0 +1,556 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+# define EXTSTD_FLAT_HASH_MAP_SSE2
+# include <emmintrin.h>
+#endif
+
+#if defined(_MSC_VER)
+# include <intrin.h>
+#endif
+
+namespace extstd::containers
+{
+    /**
+     * Finalizer of SplitMix64. Spreads every input bit over the whole output, so that keys that only
+     * differ in their high bits (GUIDs sharing a counter) or that are sequential (DBC IDs) do not pile
+     * up in the same groups.
+     */
+    inline uint64_t mix64(uint64_t value)
+    {
+        value ^= value >> 30;
+        value *= 0xBF58476D1CE4E5B9uLL;
+        value ^= value >> 27;
+        value *= 0x94D049BB133111EBuLL;
+        value ^= value >> 31;
+        return value;
+    }
+
+    namespace impl
+    {
+        using ctrl_t = int8_t;
+
+        constexpr ctrl_t ctrl_empty = -128;  // 0b10000000
+        constexpr ctrl_t ctrl_deleted = -2;  // 0b11111110
+
+        constexpr size_t group_width = 16;
+
+        /// Sixteen control bytes, matched all at once.
+        struct group
+        {
+            explicit group(ctrl_t const* ctrl)
+            {
+#ifdef EXTSTD_FLAT_HASH_MAP_SSE2
+                _ctrl = _mm_loadu_si128(reinterpret_cast<__m128i const*>(ctrl));
+#else
+                memcpy(_ctrl, ctrl, group_width);
+#endif
+            }
+
+            /// Bit i is set if slot i holds a value whose short hash is {@param hash}.
+            uint32_t match(ctrl_t hash) const
+            {
+#ifdef EXTSTD_FLAT_HASH_MAP_SSE2
+                return uint32_t(_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_set1_epi8(hash), _ctrl)));
+#else
+                uint32_t mask = 0;
+                for (size_t i = 0; i < group_width; ++i)
+                    mask |= uint32_t(_ctrl[i] == hash) << i;
+                return mask;
+#endif
+            }
+
+            uint32_t match_empty() const { return match(ctrl_empty); }
+
+            /// Bit i is set if slot i is either empty or deleted.
+            uint32_t match_non_full() const
+            {
+#ifdef EXTSTD_FLAT_HASH_MAP_SSE2
+                return uint32_t(_mm_movemask_epi8(_ctrl));
+#else
+                uint32_t mask = 0;
+                for (size_t i = 0; i < group_width; ++i)
+                    mask |= uint32_t(_ctrl[i] < 0) << i;
+                return mask;
+#endif
+            }
+
+        private:
+#ifdef EXTSTD_FLAT_HASH_MAP_SSE2
+            __m128i _ctrl;
+#else
+            ctrl_t _ctrl[group_width];
+#endif
+        };
+
+        inline uint32_t lowest_bit(uint32_t mask)
+        {
+#if defined(_MSC_VER)
+            unsigned long index;
+            _BitScanForward(&index, mask);
+            return uint32_t(index);
+#else
+            return uint32_t(__builtin_ctz(mask));
+#endif
+        }
+    }
+
+    /**
+     * An open-addressing hash map in the spirit of Abseil's SwissTable.
+     *
+     * Values are stored inline in a single array, next to an array of one-byte control words holding
+     * seven bits of each key's hash. Lookups compare sixteen control words at once, and only touch
+     * the values whose control word matches.
+     *
+     * Unlike std::unordered_map, inserting may move every value: pointers and iterators are
+     * invalidated by any insertion that grows the map, and by rehash() and reserve().
+     */
+    template <typename K, typename V, typename Hash = std::hash<K>, typename KeyEqual = std::equal_to<K>>
+    class flat_hash_map final
+    {
+        using ctrl_t = impl::ctrl_t;
+
+    public:
+        using key_type = K;
+        using mapped_type = V;
+        using value_type = std::pair<const K, V>;
+        using size_type = size_t;
+        using hasher = Hash;
+        using key_equal = KeyEqual;
+
+        template <bool Const>
+        class basic_iterator final
+        {
+            friend class flat_hash_map;
+
+            using slot_pointer = typename std::conditional<Const, std::pair<const K, V> const*, std::pair<const K, V>*>::type;
+
+            basic_iterator(ctrl_t const* ctrl, ctrl_t const* end, slot_pointer slot) : _ctrl(ctrl), _end(end), _slot(slot)
+            {
+                skip_empty_slots();
+            }
+
+        public:
+            using iterator_category = std::forward_iterator_tag;
+            using value_type = std::pair<const K, V>;
+            using difference_type = std::ptrdiff_t;
+            using pointer = slot_pointer;
+            using reference = typename std::conditional<Const, value_type const&, value_type&>::type;
+
+            basic_iterator() { }
+
+            template <bool OtherConst, typename = typename std::enable_if<Const && !OtherConst>::type>
+            basic_iterator(basic_iterator<OtherConst> const& other) : _ctrl(other._ctrl), _end(other._end), _slot(other._slot) { }
+
+            reference operator * () const { return *_slot; }
+            pointer operator -> () const { return _slot; }
+
+            basic_iterator& operator ++ ()
+            {
+                ++_ctrl;
+                ++_slot;
+                skip_empty_slots();
+                return *this;
+            }
+
+            basic_iterator operator ++ (int)
+            {
+                basic_iterator other(*this);
+                ++*this;
+                return other;
+            }
+
+            template <bool OtherConst>
+            bool operator == (basic_iterator<OtherConst> const& other) const { return _ctrl == other._ctrl; }
+
+            template <bool OtherConst>
+            bool operator != (basic_iterator<OtherConst> const& other) const { return _ctrl != other._ctrl; }
+
+        private:
+            template <bool> friend class basic_iterator;
+
+            void skip_empty_slots()
+            {
+                while (_ctrl != _end && *_ctrl < 0)
+                {
+                    ++_ctrl;
+                    ++_slot;
+                }
+            }
+
+            ctrl_t const* _ctrl = nullptr;
+            ctrl_t const* _end = nullptr;
+            slot_pointer _slot = nullptr;
+        };
+
+        using iterator = basic_iterator<false>;
+        using const_iterator = basic_iterator<true>;
+
+        flat_hash_map() { }
+
+        flat_hash_map(std::initializer_list<value_type> values)
+        {
+            reserve(values.size());
+            for (value_type const& value : values)
+                insert(value);
+        }
+
+        flat_hash_map(flat_hash_map const& other)
+        {
+            reserve(other.size());
+            for (value_type const& value : other)
+                insert(value);
+        }
+
+        flat_hash_map(flat_hash_map&& other) noexcept
+        {
+            swap(other);
+        }
+
+        flat_hash_map& operator = (flat_hash_map const& other)
+        {
+            if (this != &other)
+            {
+                flat_hash_map copy(other);
+                swap(copy);
+            }
+            return *this;
+        }
+
+        flat_hash_map& operator = (flat_hash_map&& other) noexcept
+        {
+            if (this != &other)
+            {
+                flat_hash_map moved(std::move(other));
+                swap(moved);
+            }
+            return *this;
+        }
+
+        ~flat_hash_map()
+        {
+            destroy_slots();
+            deallocate();
+        }
+
+        void swap(flat_hash_map& other) noexcept
+        {
+            std::swap(_ctrl, other._ctrl);
+            std::swap(_slots, other._slots);
+            std::swap(_capacity, other._capacity);
+            std::swap(_size, other._size);
+            std::swap(_growthLeft, other._growthLeft);
+        }
+
+        iterator begin() { return iterator(_ctrl, _ctrl + _capacity, _slots); }
+        iterator end() { return iterator(_ctrl + _capacity, _ctrl + _capacity, _slots + _capacity); }
+        const_iterator begin() const { return const_iterator(_ctrl, _ctrl + _capacity, _slots); }
+        const_iterator end() const { return const_iterator(_ctrl + _capacity, _ctrl + _capacity, _slots + _capacity); }
+        const_iterator cbegin() const { return begin(); }
+        const_iterator cend() const { return end(); }
+
+        bool empty() const { return _size == 0; }
+        size_type size() const { return _size; }
+        size_type capacity() const { return _capacity; }
+
+        /// Destroys every value, but keeps the memory around.
+        void clear()
+        {
+            destroy_slots();
+            if (_capacity != 0)
+                reset_ctrl();
+            _size = 0;
+            _growthLeft = max_load(_capacity);
+        }
+
+        /// Makes room for at least {@param count} values without further allocations.
+        void reserve(size_type count)
+        {
+            if (count > max_load(_capacity))
+                rehash(capacity_for(count));
+        }
+
+        /// Rebuilds the table with room for at least {@param capacity} slots, dropping every tombstone.
+        void rehash(size_type capacity)
+        {
+            size_type minimumCapacity = std::max(capacity, capacity_for(_size));
+            capacity = impl::group_width;
+            while (capacity < minimumCapacity)
+                capacity *= 2;
+
+            ctrl_t* oldCtrl = _ctrl;
+            value_type* oldSlots = _slots;
+            size_type oldCapacity = _capacity;
+
+            allocate(capacity);
+
+            for (size_type i = 0; i < oldCapacity; ++i)
+            {
+                if (oldCtrl[i] < 0)
+                    continue;
+
+                size_t hash = hash_of(oldSlots[i].first);
+                size_type index = find_non_full(hash);
+                set_ctrl(index, short_hash(hash));
+                new (_slots + index) value_type(std::move(oldSlots[i]));
+                oldSlots[i].~value_type();
+            }
+
+            _growthLeft = max_load(_capacity) - _size;
+
+            deallocate(oldCtrl, oldSlots, oldCapacity);
+        }
+
+        iterator find(K const& key)
+        {
+            size_type index = find_index(key);
+            return index == npos ? end() : iterator_at(index);
+        }
+
+        const_iterator find(K const& key) const
+        {
+            size_type index = find_index(key);
+            return index == npos ? end() : const_iterator_at(index);
+        }
+
+        size_type count(K const& key) const { return find_index(key) == npos ? 0 : 1; }
+        bool contains(K const& key) const { return find_index(key) != npos; }
+
+        V& at(K const& key)
+        {
+            size_type index = find_index(key);
+            if (index == npos)
+                throw std::out_of_range("flat_hash_map::at");
+            return _slots[index].second;
+        }
+
+        V const& at(K const& key) const
+        {
+            size_type index = find_index(key);
+            if (index == npos)
+                throw std::out_of_range("flat_hash_map::at");
+            return _slots[index].second;
+        }
+
+        V& operator [] (K const& key) { return try_emplace(key).first->second; }
+        V& operator [] (K&& key) { return try_emplace(std::move(key)).first->second; }
+
+        template <typename Key, typename... Args>
+        std::pair<iterator, bool> try_emplace(Key&& key, Args&&... args)
+        {
+            size_t hash = hash_of(key);
+            size_type index = find_index(key, hash);
+            if (index != npos)
+                return { iterator_at(index), false };
+
+            index = prepare_insert(hash);
+            new (_slots + index) value_type(std::piecewise_construct,
+                std::forward_as_tuple(std::forward<Key>(key)),
+                std::forward_as_tuple(std::forward<Args>(args)...));
+            ++_size;
+            return { iterator_at(index), true };
+        }
+
+        template <typename... Args>
+        std::pair<iterator, bool> emplace(Args&&... args)
+        {
+            std::pair<K, V> value(std::forward<Args>(args)...);
+            return try_emplace(std::move(value.first), std::move(value.second));
+        }
+
+        std::pair<iterator, bool> insert(value_type const& value)
+        {
+            return try_emplace(value.first, value.second);
+        }
+
+        template <typename M>
+        std::pair<iterator, bool> insert_or_assign(K const& key, M&& value)
+        {
+            auto result = try_emplace(key, std::forward<M>(value));
+            if (!result.second)
+                result.first->second = std::forward<M>(value);
+            return result;
+        }
+
+        size_type erase(K const& key)
+        {
+            size_type index = find_index(key);
+            if (index == npos)
+                return 0;
+
+            erase_at(index);
+            return 1;
+        }
+
+        iterator erase(const_iterator position)
+        {
+            size_type index = size_type(position._slot - _slots);
+            erase_at(index);
+
+            // The slot is now deleted; the iterator skips ahead to the next value.
+            return iterator_at(index);
+        }
+
+        iterator erase(iterator position) { return erase(const_iterator(position)); }
+
+    private:
+        static constexpr size_type npos = size_type(-1);
+
+        static size_type max_load(size_type capacity) { return capacity - capacity / 8; }
+
+        static size_type capacity_for(size_type count)
+        {
+            size_type capacity = impl::group_width;
+            while (max_load(capacity) < count)
+                capacity *= 2;
+            return capacity;
+        }
+
+        static size_t hash_of(K const& key) { return size_t(mix64(uint64_t(Hash()(key)))); }
+        static ctrl_t short_hash(size_t hash) { return ctrl_t(hash & 0x7F); }
+
+        size_type probe_start(size_t hash) const { return (hash >> 7) & (_capacity - 1); }
+
+        iterator iterator_at(size_type index) { return iterator(_ctrl + index, _ctrl + _capacity, _slots + index); }
+        const_iterator const_iterator_at(size_type index) const { return const_iterator(_ctrl + index, _ctrl + _capacity, _slots + index); }
+
+        size_type find_index(K const& key) const
+        {
+            return _capacity == 0 ? npos : find_index(key, hash_of(key));
+        }
+
+        template <typename Key>
+        size_type find_index(Key const& key, size_t hash) const
+        {
+            if (_capacity == 0)
+                return npos;
+
+            size_type mask = _capacity - 1;
+            size_type position = probe_start(hash);
+            ctrl_t shortHash = short_hash(hash);
+
+            // Triangular probing over groups visits every group exactly once when the capacity is a power of two.
+            for (size_type step = impl::group_width; ; step += impl::group_width)
+            {
+                impl::group group(_ctrl + position);
+                for (uint32_t matches = group.match(shortHash); matches != 0; matches &= matches - 1)
+                {
+                    size_type index = (position + impl::lowest_bit(matches)) & mask;
+                    if (KeyEqual()(_slots[index].first, key))
+                        return index;
+                }
+
+                if (group.match_empty() != 0)
+                    return npos;
+
+                position = (position + step) & mask;
+            }
+        }
+
+        size_type find_non_full(size_t hash) const
+        {
+            size_type mask = _capacity - 1;
+            size_type position = probe_start(hash);
+
+            for (size_type step = impl::group_width; ; step += impl::group_width)
+            {
+                uint32_t candidates = impl::group(_ctrl + position).match_non_full();
+                if (candidates != 0)
+                    return (position + impl::lowest_bit(candidates)) & mask;
+
+                position = (position + step) & mask;
+            }
+        }
+
+        size_type prepare_insert(size_t hash)
+        {
+            if (_growthLeft == 0)
+            {
+                // Tombstones count against the load factor. Rehashing in place is enough to get rid of them
+                // if the table is not actually full.
+                rehash(_size + 1 > max_load(_capacity) / 2 ? std::max<size_type>(_capacity * 2, impl::group_width) : _capacity);
+            }
+
+            size_type index = find_non_full(hash);
+            if (_ctrl[index] == impl::ctrl_empty)
+                --_growthLeft;
+
+            set_ctrl(index, short_hash(hash));
+            return index;
+        }
+
+        void erase_at(size_type index)
+        {
+            _slots[index].~value_type();
+            set_ctrl(index, impl::ctrl_deleted);
+            --_size;
+        }
+
+        /// The first group_width control words are mirrored past the end, so that groups never need to wrap.
+        void set_ctrl(size_type index, ctrl_t value)
+        {
+            _ctrl[index] = value;
+            if (index < impl::group_width)
+                _ctrl[_capacity + index] = value;
+        }
+
+        void reset_ctrl()
+        {
+            memset(_ctrl, static_cast<uint8_t>(impl::ctrl_empty), _capacity + impl::group_width);
+        }
+
+        void allocate(size_type capacity)
+        {
+            _ctrl = new ctrl_t[capacity + impl::group_width];
+            _slots = std::allocator<value_type>().allocate(capacity);
+            _capacity = capacity;
+            reset_ctrl();
+        }
+
+        void deallocate()
+        {
+            deallocate(_ctrl, _slots, _capacity);
+            _ctrl = nullptr;
+            _slots = nullptr;
+            _capacity = 0;
+        }
+
+        static void deallocate(ctrl_t* ctrl, value_type* slots, size_type capacity)
+        {
+            if (capacity == 0)
+                return;
+
+            delete[] ctrl;
+            std::allocator<value_type>().deallocate(slots, capacity);
+        }
+
+        void destroy_slots()
+        {
+            if constexpr (!std::is_trivially_destructible<value_type>::value)
+            {
+                for (size_type i = 0; i < _capacity; ++i)
+                    if (_ctrl[i] >= 0)
+                        _slots[i].~value_type();
+            }
+        }
+
+        ctrl_t* _ctrl = nullptr;
+        value_type* _slots = nullptr;
+        size_type _capacity = 0;
+        size_type _size = 0;
+        size_type _growthLeft = 0;
+    };
+}
@@ -0,0 +1,67 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+
+namespace extstd::threading
+{
+    /**
+     * Wait-free single producer, single consumer triple buffer.
+     *
+     * The producer fills write_buffer() and calls publish(); the consumer calls acquire() and reads
+     * read_buffer(). Neither side ever blocks: the producer always owns one buffer, the consumer
+     * owns another, and the third one sits in the middle, holding the most recently published value.
+     *
+     * The consumer always observes a complete value, never a partially written one. Values published
+     * while the consumer is not looking are simply overwritten.
+     */
+    template <typename T>
+    class triple_buffer final
+    {
+        // Low bits hold the index of the middle buffer, the high bit is set if it has not been acquired yet.
+        static constexpr uint8_t index_mask = 0x03;
+        static constexpr uint8_t fresh_bit = 0x04;
+
+    public:
+        triple_buffer() : _middle(1), _write(0), _read(2) { }
+
+        triple_buffer(triple_buffer const&) = delete;
+        triple_buffer(triple_buffer&&) = delete;
+
+        /// The buffer owned by the producer. Its content is stale: it is whatever was published two swaps ago.
+        T& write_buffer() { return _buffers[_write]; }
+
+        /// Makes the write buffer visible to the consumer, and hands the producer a new one.
+        void publish()
+        {
+            uint8_t previous = _middle.exchange(_write | fresh_bit, std::memory_order_acq_rel);
+            _write = previous & index_mask;
+        }
+
+        /**
+         * Takes ownership of the most recently published buffer, if any was published since the last call.
+         *
+         * @returns true if read_buffer() changed.
+         */
+        bool acquire()
+        {
+            if ((_middle.load(std::memory_order_relaxed) & fresh_bit) == 0)
+                return false;
+
+            uint8_t previous = _middle.exchange(_read, std::memory_order_acq_rel);
+            _read = previous & index_mask;
+            return true;
+        }
+
+        /// The buffer owned by the consumer.
+        T const& read_buffer() const { return _buffers[_read]; }
+
+    private:
+        std::array<T, 3> _buffers;
+
+        alignas(64) std::atomic<uint8_t> _middle;
+        alignas(64) uint8_t _write; // Only touched by the producer.
+        alignas(64) uint8_t _read;  // Only touched by the consumer.
+    };
+}
@@ -1,6 +1,7 @@
 #include <shared/filesystem/disk_file_system.hpp>
 #include <shared/assert/assert.hpp>
 
+#include <algorithm>
 #include <stdexcept>
 #include <boost/filesystem.hpp>
 
@@ -69,12 +70,12 @@ namespace shared::filesystem
         BOOST_ASSERT_MSG(_fileDescriptor != -1, "Failed to open the file");
 
         struct stat st;
-        ::stat(fileName.c_str(), &str);
+        ::fstat(_fileDescriptor, &st);
 
         _fileSize = st.st_size;
 
         _mapped = mmap(nullptr, st.st_size, PROT_READ, MAP_PRIVATE | MAP_POPULATE, _fileDescriptor, 0);
-        BOOST_ASSERT_MSG(_map != MAP_FAILED, "Failed to map the file to memory");
+        BOOST_ASSERT_MSG(_mapped != MAP_FAILED, "Failed to map the file to memory");
 #endif
     }
 
@@ -90,13 +91,13 @@ namespace shared::filesystem
 
     size_t disk_file::ReadBytes(size_t offset, size_t length, uint8_t* buffer, size_t bufferSize)
     {
-        auto availableDataLength = GetFileSize() - offset;
-        if (bufferSize < availableDataLength)
-            availableDataLength = bufferSize;
+        size_t fileSize = GetFileSize();
+        if (offset >= fileSize)
+            return 0;
 
-        memcpy(buffer, _mapped + offset, availableDataLength);
-
-        return availableDataLength;
+        length = std::min({ length, bufferSize, fileSize - offset });
+        memcpy(buffer, reinterpret_cast<uint8_t const*>(_mapped) + offset, length);
+        return length;
     }
 
     uint8_t const* disk_file::GetData()
@@ -120,9 +121,17 @@ namespace shared::filesystem
         _mapFile = INVALID_HANDLE_VALUE;
         _fileHandle = INVALID_HANDLE_VALUE;
 #elif PLATFORM == PLATFORM_UNIX || PLATFORM == PLATFORM_APPLE
-        BOOST_ASSERT_MSG(munmap(_fileDescriptor, _fileSize) == 0, "Failed to unmap file from memory");
-        close(_fileDescriptor);
+        if (_mapped != nullptr && _mapped != MAP_FAILED)
+        {
+            int result = munmap(_mapped, _fileSize);
+            BOOST_ASSERT_MSG(result == 0, "Failed to unmap file from memory");
+        }
+
+        if (_fileDescriptor != -1)
+            close(_fileDescriptor);
+
         _mapped = nullptr;
+        _fileDescriptor = -1;
 #endif
     }
 }
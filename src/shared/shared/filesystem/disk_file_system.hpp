@@ -43,8 +43,8 @@ namespace shared::filesystem
         HANDLE _mapFile = INVALID_HANDLE_VALUE;
         uint8_t* _mapped{ nullptr };
 #elif (PLATFORM == PLATFORM_APPLE) || (PLATFORM == PLATFORM_UNIX)
-        int _fileDescriptor;
-        void* _mapped;
+        int _fileDescriptor = -1;
+        void* _mapped = nullptr;
 #endif
     };
 
@@ -64,6 +64,8 @@ namespace shared::filesystem
         std::shared_ptr<disk_file> OpenFile(const std::string& relFilePath) override;
         bool FileExists(const std::string& relFilePath) const override;
 
+        const std::string& GetRootFolder() const { return _rootFolder; }
+
     private:
         std::string _rootFolder;
     };
@@ -28,8 +28,8 @@ namespace shared::filesystem
         virtual size_t ReadBytes(size_t offset, size_t length, uint8_t* buffer, size_t bufferSize) = 0;
 
         template <typename U>
-        inline U* Read(size_t byteOffset) const {
-            return reinterpret_cast<U*>(GetData() + offset);
+        inline U const* Read(size_t byteOffset) {
+            return reinterpret_cast<U const*>(GetData() + byteOffset);
         }
     };
 
@@ -0,0 +1,89 @@
+#include <shared/filesystem/mpq_file_cache.hpp>
+
+namespace shared::filesystem
+{
+    mpq_file_cache::mpq_file_cache(size_t budget)
+    {
+        _statistics.budget = budget;
+    }
+
+    mpq_file_cache::contents_ptr mpq_file_cache::Find(const std::string& normalizedPath)
+    {
+        std::lock_guard<std::mutex> lock(_lock);
+
+        auto itr = _index.find(std::string_view(normalizedPath));
+        if (itr == _index.end())
+        {
+            ++_statistics.missCount;
+            return nullptr;
+        }
+
+        ++_statistics.hitCount;
+        _entries.splice(_entries.begin(), _entries, itr->second);
+        return itr->second->contents;
+    }
+
+    mpq_file_cache::contents_ptr mpq_file_cache::Insert(const std::string& normalizedPath, contents_ptr contents)
+    {
+        std::lock_guard<std::mutex> lock(_lock);
+
+        auto itr = _index.find(std::string_view(normalizedPath));
+        if (itr != _index.end())
+        {
+            _entries.splice(_entries.begin(), _entries, itr->second);
+            return itr->second->contents;
+        }
+
+        if (contents == nullptr || contents->size() > _statistics.budget)
+            return contents;
+
+        _entries.push_front(entry{ normalizedPath, contents });
+        _index.emplace(std::string_view(_entries.front().path), _entries.begin());
+
+        ++_statistics.fileCount;
+        _statistics.byteCount += contents->size();
+
+        Trim();
+        return contents;
+    }
+
+    void mpq_file_cache::SetBudget(size_t budget)
+    {
+        std::lock_guard<std::mutex> lock(_lock);
+
+        _statistics.budget = budget;
+        Trim();
+    }
+
+    void mpq_file_cache::Clear()
+    {
+        std::lock_guard<std::mutex> lock(_lock);
+
+        _index.clear();
+        _entries.clear();
+
+        _statistics.fileCount = 0;
+        _statistics.byteCount = 0;
+    }
+
+    mpq_cache_statistics mpq_file_cache::GetStatistics() const
+    {
+        std::lock_guard<std::mutex> lock(_lock);
+        return _statistics;
+    }
+
+    void mpq_file_cache::Trim()
+    {
+        while (_statistics.byteCount > _statistics.budget && !_entries.empty())
+        {
+            entry& leastRecent = _entries.back();
+
+            _statistics.byteCount -= leastRecent.contents->size();
+            --_statistics.fileCount;
+            ++_statistics.evictionCount;
+
+            _index.erase(std::string_view(leastRecent.path));
+            _entries.pop_back();
+        }
+    }
+}
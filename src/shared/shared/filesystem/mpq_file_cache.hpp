@@ -0,0 +1,80 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <extstd/containers/flat_hash_map.hpp>
+
+namespace shared::filesystem
+{
+    struct mpq_cache_statistics
+    {
+        size_t hitCount = 0;
+        size_t missCount = 0;
+        size_t evictionCount = 0;
+
+        size_t fileCount = 0;
+        /// Decompressed bytes currently held by the cache.
+        size_t byteCount = 0;
+        size_t budget = 0;
+
+        double GetHitRate() const { return hitCount + missCount != 0 ? double(hitCount) / double(hitCount + missCount) : 0.0; }
+    };
+
+    /**
+     * Decompressed contents of recently opened MPQ files, keyed by normalized path. Once the contents exceed the
+     * byte budget, the least recently opened files are dropped first.
+     *
+     * Files opened from the cache share its copy of the contents, which must never be written to. Evicted contents
+     * stay alive for as long as a file still uses them, but stop counting against the budget.
+     */
+    class mpq_file_cache final
+    {
+    public:
+        using contents_ptr = std::shared_ptr<std::vector<uint8_t>>;
+
+        explicit mpq_file_cache(size_t budget);
+
+        /// Returns nullptr on a miss. Either way, the lookup counts towards the hit rate.
+        contents_ptr Find(const std::string& normalizedPath);
+
+        /**
+         * Caches {@param contents} under {@param normalizedPath} and returns what the cache now holds for it, which is
+         * whatever another thread inserted first. Contents larger than the budget are returned without being cached.
+         */
+        contents_ptr Insert(const std::string& normalizedPath, contents_ptr contents);
+
+        /// Zero disables the cache.
+        void SetBudget(size_t budget);
+        void Clear();
+
+        mpq_cache_statistics GetStatistics() const;
+
+    private:
+        struct entry
+        {
+            std::string path;
+            contents_ptr contents;
+        };
+
+        using entry_list = std::list<entry>;
+
+        /// Drops the least recently used entries until the cache fits its budget. Must be called with {@link _lock} held.
+        void Trim();
+
+        mutable std::mutex _lock;
+
+        /// Most recently used first.
+        entry_list _entries;
+        /// Keys point into {@link _entries}, whose nodes never move.
+        extstd::containers::flat_hash_map<std::string_view, entry_list::iterator> _index;
+
+        mpq_cache_statistics _statistics;
+    };
+}
@@ -0,0 +1,241 @@
+#include <shared/filesystem/mpq_file_loader.hpp>
+
+#include <extstd/threading/join_all.hpp>
+
+#include <algorithm>
+
+namespace shared::filesystem
+{
+    mpq_file_loader* mpq_file_loader::Instance()
+    {
+        static mpq_file_loader instance(*mpq_file_system::Instance(), 2);
+
+        return &instance;
+    }
+
+    mpq_file_loader::mpq_file_loader(mpq_file_system& fileSystem, size_t threadCount) : _fileSystem(fileSystem)
+    {
+        _latencies.reserve(LatencySampleCount);
+        _workers.reserve(std::max(threadCount, size_t(1)));
+
+        try {
+            for (size_t i = 0; i < std::max(threadCount, size_t(1)); ++i)
+                _workers.emplace_back([this]() -> void { Run(); });
+        }
+        catch (...) {
+            {
+                std::lock_guard<std::mutex> lock(_lock);
+                _stop = true;
+            }
+
+            _condition.notify_all();
+            extstd::threading::join_all(_workers);
+            throw;
+        }
+    }
+
+    mpq_file_loader::~mpq_file_loader()
+    {
+        std::vector<std::shared_ptr<waiter>> cancelled;
+
+        {
+            std::lock_guard<std::mutex> lock(_lock);
+            _stop = true;
+
+            for (auto&& queued : _queue)
+            {
+                _jobs.erase(queued.second->filePath);
+                for (std::shared_ptr<waiter>& request : queued.second->waiters)
+                    cancelled.push_back(std::move(request));
+            }
+
+            _queue.clear();
+            _statistics.cancelledCount += cancelled.size();
+        }
+
+        _condition.notify_all();
+
+        for (std::shared_ptr<waiter> const& request : cancelled)
+            request->promise.set_value(nullptr);
+
+        extstd::threading::join_all(_workers);
+    }
+
+    mpq_load_request mpq_file_loader::Load(const std::string& filePath, float priority, callback_type callback)
+    {
+        auto request = std::make_shared<waiter>();
+        request->filePath = mpq_file_system::NormalizePath(filePath);
+        request->callback = std::move(callback);
+
+        mpq_load_request handle(this, request);
+
+        {
+            std::lock_guard<std::mutex> lock(_lock);
+
+            auto itr = _jobs.find(request->filePath);
+            if (itr != _jobs.end())
+            {
+                std::shared_ptr<job> const& pending = itr->second;
+                pending->waiters.push_back(request);
+                ++_statistics.coalescedCount;
+
+                if (!pending->reading && priority < pending->priority)
+                {
+                    _queue.erase(queue_key(pending->priority, pending->sequence));
+                    pending->priority = priority;
+                    _queue.emplace(queue_key(pending->priority, pending->sequence), pending);
+                }
+
+                return handle;
+            }
+
+            if (_stop)
+            {
+                ++_statistics.cancelledCount;
+                request->promise.set_value(nullptr);
+                return handle;
+            }
+
+            auto pending = std::make_shared<job>();
+            pending->filePath = request->filePath;
+            pending->priority = priority;
+            pending->sequence = _nextSequence++;
+            pending->queueTime = clock::now();
+            pending->waiters.push_back(request);
+
+            _queue.emplace(queue_key(pending->priority, pending->sequence), pending);
+            _jobs.emplace(pending->filePath, std::move(pending));
+        }
+
+        _condition.notify_one();
+        return handle;
+    }
+
+    void mpq_file_loader::Cancel(std::shared_ptr<waiter> const& request)
+    {
+        {
+            std::lock_guard<std::mutex> lock(_lock);
+
+            auto itr = _jobs.find(request->filePath);
+            if (itr == _jobs.end())
+                return;
+
+            std::shared_ptr<job> pending = itr->second;
+
+            // Not found if the request was already handed its file, or cancelled before.
+            auto position = std::find(pending->waiters.begin(), pending->waiters.end(), request);
+            if (position == pending->waiters.end())
+                return;
+
+            pending->waiters.erase(position);
+            ++_statistics.cancelledCount;
+
+            // A load being read finishes regardless, and may still have joined requests by then.
+            if (pending->waiters.empty() && !pending->reading)
+            {
+                _queue.erase(queue_key(pending->priority, pending->sequence));
+                _jobs.erase(itr);
+            }
+        }
+
+        request->promise.set_value(nullptr);
+    }
+
+    mpq_loader_statistics mpq_file_loader::GetStatistics() const
+    {
+        std::vector<uint64_t> latencies;
+        mpq_loader_statistics statistics;
+
+        {
+            std::lock_guard<std::mutex> lock(_lock);
+
+            statistics = _statistics;
+            statistics.queueDepth = _queue.size();
+            latencies = _latencies;
+        }
+
+        if (latencies.empty())
+            return statistics;
+
+        auto percentile = [&latencies](size_t percent) {
+            auto nth = latencies.begin() + (latencies.size() - 1) * percent / 100;
+            std::nth_element(latencies.begin(), nth, latencies.end());
+            return std::chrono::microseconds(*nth);
+        };
+
+        statistics.latencyP50 = percentile(50);
+        statistics.latencyP90 = percentile(90);
+        statistics.latencyP99 = percentile(99);
+        return statistics;
+    }
+
+    void mpq_file_loader::Run()
+    {
+        for (;;)
+        {
+            std::shared_ptr<job> pending;
+
+            {
+                std::unique_lock<std::mutex> lock(_lock);
+
+                _condition.wait(lock, [this]() { return _stop || !_queue.empty(); });
+                if (_stop)
+                    return;
+
+                pending = std::move(_queue.begin()->second);
+                _queue.erase(_queue.begin());
+
+                pending->reading = true;
+                ++_statistics.inFlightCount;
+            }
+
+            std::shared_ptr<mpq_file> file;
+            try {
+                file = _fileSystem.OpenFile(pending->filePath);
+            }
+            catch (...) {
+                // Unreadable files are reported like missing ones.
+            }
+
+            std::vector<std::shared_ptr<waiter>> requests;
+
+            {
+                std::lock_guard<std::mutex> lock(_lock);
+
+                _jobs.erase(pending->filePath);
+                requests.swap(pending->waiters);
+
+                --_statistics.inFlightCount;
+                ++_statistics.completedCount;
+
+                uint64_t latency = uint64_t(std::chrono::duration_cast<std::chrono::microseconds>(clock::now() - pending->queueTime).count());
+                if (_latencies.size() < LatencySampleCount)
+                    _latencies.push_back(latency);
+                else
+                    _latencies[_nextLatency] = latency;
+
+                _nextLatency = (_nextLatency + 1) % LatencySampleCount;
+            }
+
+            for (std::shared_ptr<waiter> const& request : requests)
+            {
+                if (request->callback)
+                    request->callback(file);
+
+                request->promise.set_value(file);
+            }
+        }
+    }
+
+    mpq_load_request::mpq_load_request(mpq_file_loader* loader, std::shared_ptr<waiter> request)
+        : _loader(loader), _request(std::move(request))
+    {
+        _future = _request->promise.get_future().share();
+    }
+
+    void mpq_load_request::Cancel()
+    {
+        if (_request != nullptr)
+            _loader->Cancel(_request);
+    }
+}
@@ -0,0 +1,156 @@
+#pragma once
+
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <future>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include <shared/filesystem/mpq_file_system.hpp>
+
+#include <extstd/containers/flat_hash_map.hpp>
+
+namespace shared::filesystem
+{
+    class mpq_load_request;
+
+    struct mpq_loader_statistics
+    {
+        /// Loads waiting for a worker.
+        size_t queueDepth = 0;
+        /// Loads a worker is reading.
+        size_t inFlightCount = 0;
+        size_t completedCount = 0;
+        /// Requests dropped before their file was handed to them.
+        size_t cancelledCount = 0;
+        /// Requests for a path already queued or being read, which joined that load instead of queuing their own.
+        size_t coalescedCount = 0;
+
+        /// Time from a load being queued to its file being read, over the most recent loads.
+        std::chrono::microseconds latencyP50{ 0 };
+        std::chrono::microseconds latencyP90{ 0 };
+        std::chrono::microseconds latencyP99{ 0 };
+    };
+
+    /**
+     * Reads MPQ files on worker threads, in priority order, so that callers such as packet handlers never wait on
+     * decompression. Requests for a path already queued or being read share that load.
+     *
+     * Workers read through {@link mpq_file_system::OpenFile}, so they only read in parallel up to the file system's
+     * reader count; the rest of their time goes to the callbacks.
+     */
+    class mpq_file_loader final
+    {
+        friend class mpq_load_request;
+
+    public:
+        /// Receives the file, or nullptr if it couldn't be found or read. Runs on a loader thread and must not throw.
+        using callback_type = std::function<void(std::shared_ptr<mpq_file> const&)>;
+
+        /// Loads through {@link mpq_file_system::Instance} on two threads, so that one reads while the other runs callbacks.
+        static mpq_file_loader* Instance();
+
+        mpq_file_loader(mpq_file_system& fileSystem, size_t threadCount);
+
+        /// Cancels every queued load and waits for the ones being read.
+        ~mpq_file_loader();
+
+        mpq_file_loader(mpq_file_loader&&) = delete;
+        mpq_file_loader(mpq_file_loader const&) = delete;
+
+        /**
+         * Queues a load of {@param filePath}. Lower {@param priority} values load first - the squared distance to the
+         * player, for instance - and equal ones in request order. Joining a queued load moves it up to the lower of
+         * both priorities.
+         *
+         * {@param callback}, if any, runs before the future of the request resolves.
+         */
+        mpq_load_request Load(const std::string& filePath, float priority, callback_type callback = { });
+
+        mpq_loader_statistics GetStatistics() const;
+
+    private:
+        using clock = std::chrono::steady_clock;
+
+        struct waiter
+        {
+            std::string filePath;
+            callback_type callback;
+            std::promise<std::shared_ptr<mpq_file>> promise;
+        };
+
+        struct job
+        {
+            std::string filePath;
+            float priority = 0.0f;
+            uint64_t sequence = 0;
+            clock::time_point queueTime;
+            bool reading = false;
+
+            std::vector<std::shared_ptr<waiter>> waiters;
+        };
+
+        /// Priority first, then request order.
+        using queue_key = std::pair<float, uint64_t>;
+
+        /// Latencies kept for the percentiles.
+        constexpr static const size_t LatencySampleCount = 1024;
+
+        void Run();
+        void Cancel(std::shared_ptr<waiter> const& request);
+
+        mpq_file_system& _fileSystem;
+        std::vector<std::thread> _workers;
+
+        mutable std::mutex _lock;
+        std::condition_variable _condition;
+        bool _stop = false;
+
+        std::map<queue_key, std::shared_ptr<job>> _queue;
+        /// Loads queued or being read, by normalized path.
+        extstd::containers::flat_hash_map<std::string, std::shared_ptr<job>> _jobs;
+        uint64_t _nextSequence = 0;
+
+        mpq_loader_statistics _statistics;
+        /// Ring buffer of the most recent latencies, in microseconds.
+        std::vector<uint64_t> _latencies;
+        size_t _nextLatency = 0;
+    };
+
+    /// Handle to a load queued by {@link mpq_file_loader::Load}. Dropping it does not cancel the load.
+    class mpq_load_request final
+    {
+        friend class mpq_file_loader;
+
+        using waiter = mpq_file_loader::waiter;
+
+        mpq_load_request(mpq_file_loader* loader, std::shared_ptr<waiter> request);
+
+    public:
+        mpq_load_request() = default;
+
+        bool IsValid() const { return _request != nullptr; }
+
+        /// Resolves to the file, or to nullptr if it couldn't be found or read, or if the request was cancelled.
+        std::shared_future<std::shared_ptr<mpq_file>> const& GetFuture() const { return _future; }
+
+        /**
+         * Drops the request unless its file was already handed to it: its callback won't run and its future resolves
+         * to nullptr. The load itself is dropped along with its last request. Must not be called once the loader is gone.
+         */
+        void Cancel();
+
+    private:
+        mpq_file_loader* _loader = nullptr;
+        std::shared_ptr<waiter> _request;
+        std::shared_future<std::shared_ptr<mpq_file>> _future;
+    };
+}
@@ -1,6 +1,8 @@
 #include <shared/filesystem/mpq_file_system.hpp>
 #include <shared/assert/assert.hpp>
 
+#include <algorithm>
+#include <cctype>
 #include <stdexcept>
 #include <boost/filesystem.hpp>
 
@@ -16,19 +18,35 @@ namespace shared::filesystem
         if (rootFolder.length() == 0)
             return;
 
+        std::unique_lock<std::shared_mutex> lock(_stateLock);
+
         if (rootFolder == _currentRootFolder)
             return;
 
         _currentRootFolder = rootFolder;
+        _cache.Clear();
 
-        for (HANDLE archiveHandle : _archiveHandles)
-            SFileCloseArchive(archiveHandle);
+        {
+            // Nobody holds a lease while the state lock is held exclusively.
+            std::lock_guard<std::mutex> readerLock(_readerLock);
+            for (std::unique_ptr<archive_set>& archives : _idleReaders)
+                CloseArchives(*archives);
+
+            _idleReaders.clear();
+            _readerCount = 0;
+        }
 
         try {
             boost::filesystem::path rootPath = rootFolder;
             auto dataPath = rootPath / "Data" / GetLocaleString();
 
-            _archiveHandles.clear();
+            _archivePaths.clear();
+            _unlistedArchives.clear();
+            _fileIndex.clear();
+            _indexStatistics = mpq_index_statistics();
+            _contentStamp = 0;
+
+            auto archives = std::make_unique<archive_set>();
 
             boost::filesystem::directory_iterator end;
             for (boost::filesystem::directory_iterator itr(dataPath); itr != end; ++itr)
@@ -41,57 +59,374 @@ namespace shared::filesystem
 
                 HANDLE fileHandle;
                 if (SFileOpenArchive(itr->path().string<tstring>().c_str(), 0, MPQ_OPEN_READ_ONLY, &fileHandle))
-                    _archiveHandles.push_back(fileHandle);
+                {
+                    archives->push_back(fileHandle);
+                    _archivePaths.push_back(itr->path().string<tstring>());
+                }
                 else
+                {
+                    CloseArchives(*archives);
+                    _archivePaths.clear();
                     shared::assert::throw_with_trace("Error loading archive.");
+                }
+
+                // FNV-1a over everything that changes when an archive is patched or swapped.
+                auto stamp = [this](void const* data, size_t size) {
+                    for (size_t i = 0; i < size; ++i)
+                        _contentStamp = (_contentStamp ^ reinterpret_cast<uint8_t const*>(data)[i]) * 0x100000001B3uLL;
+                };
+
+                if (_contentStamp == 0)
+                    _contentStamp = 0xCBF29CE484222325uLL;
+
+                std::string archiveName = itr->path().filename().string();
+                uint64_t archiveSize = boost::filesystem::file_size(itr->path());
+                int64_t archiveTime = int64_t(boost::filesystem::last_write_time(itr->path()));
+
+                stamp(archiveName.data(), archiveName.size());
+                stamp(&archiveSize, sizeof(archiveSize));
+                stamp(&archiveTime, sizeof(archiveTime));
             }
+
+            BuildIndex(*archives);
+
+            // The handles used to build the index become the first reader.
+            std::lock_guard<std::mutex> readerLock(_readerLock);
+            _idleReaders.push_back(std::move(archives));
+            _readerCount = 1;
         }
         catch (const std::exception& e) {
             return; // Check for more specific exceptions layer
         }
     }
 
-    mpq_file_system::~mpq_file_system()
+    void mpq_file_system::BuildIndex(archive_set const& archives)
+    {
+        auto start = std::chrono::steady_clock::now();
+
+        for (uint32_t archiveIndex = 0; archiveIndex < archives.size(); ++archiveIndex)
+        {
+            HANDLE archiveHandle = archives[archiveIndex];
+
+            // Without a listfile, StormLib only knows the hashes of the names.
+            if (!SFileHasFile(archiveHandle, LISTFILE_NAME))
+            {
+                _unlistedArchives.push_back(archiveIndex);
+                continue;
+            }
+
+            SFILE_FIND_DATA findData;
+            HANDLE findHandle = SFileFindFirstFile(archiveHandle, "*", &findData, nullptr);
+            if (findHandle == nullptr)
+                continue;
+
+            do
+            {
+                // Earlier archives take precedence, as they did when every archive was probed in order.
+                _fileIndex.try_emplace(NormalizePath(findData.cFileName), archiveIndex);
+            } while (SFileFindNextFile(findHandle, &findData));
+
+            // The bundled StormLib detaches exhausted searches from their archive and then refuses to close them,
+            // leaking a few bytes per archive and per index build.
+            SFileFindClose(findHandle);
+        }
+
+        _indexStatistics.archiveCount = archives.size();
+        _indexStatistics.fileCount = _fileIndex.size();
+        _indexStatistics.unlistedArchiveCount = _unlistedArchives.size();
+        _indexStatistics.buildTime = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start);
+
+        // One control byte and one slot per bucket, plus whatever paths outgrew the small string buffer.
+        _indexStatistics.memoryUsage = _fileIndex.capacity() * (sizeof(decltype(_fileIndex)::value_type) + 1);
+        for (auto&& entry : _fileIndex)
+            if (entry.first.capacity() > std::string().capacity())
+                _indexStatistics.memoryUsage += entry.first.capacity() + 1;
+    }
+
+    std::string mpq_file_system::NormalizePath(const std::string& filePath)
+    {
+        std::string normalizedPath = filePath;
+        for (char& c : normalizedPath)
+            c = c == '/' ? '\\' : char(std::toupper(static_cast<unsigned char>(c)));
+        return normalizedPath;
+    }
+
+    uint32_t mpq_file_system::FindArchive(const std::string& filePath, archive_set const& archives) const
+    {
+        auto itr = _fileIndex.find(NormalizePath(filePath));
+        uint32_t listedArchive = itr != _fileIndex.end() ? itr->second : npos;
+
+        // Archives without a listfile can only be asked; those loaded before the indexed one still take precedence.
+        for (uint32_t archiveIndex : _unlistedArchives)
+            if (archiveIndex < listedArchive && SFileHasFile(archives[archiveIndex], filePath.c_str()))
+                return archiveIndex;
+
+        return listedArchive;
+    }
+
+    std::unique_ptr<mpq_file_system::archive_set> mpq_file_system::OpenArchives() const
+    {
+        auto archives = std::make_unique<archive_set>();
+        archives->reserve(_archivePaths.size());
+
+        for (auto const& archivePath : _archivePaths)
+        {
+            HANDLE archiveHandle;
+            if (!SFileOpenArchive(archivePath.c_str(), 0, MPQ_OPEN_READ_ONLY, &archiveHandle))
+            {
+                CloseArchives(*archives);
+                return nullptr;
+            }
+
+            archives->push_back(archiveHandle);
+        }
+
+        return archives;
+    }
+
+    void mpq_file_system::CloseArchives(archive_set& archives)
     {
-        for (HANDLE archiveHandle : _archiveHandles)
+        for (HANDLE archiveHandle : archives)
             SFileCloseArchive(archiveHandle);
 
-        _archiveHandles.clear();
+        archives.clear();
+    }
+
+    std::unique_ptr<mpq_file_system::archive_set> mpq_file_system::AcquireReader() const
+    {
+        std::unique_lock<std::mutex> lock(_readerLock);
+        for (;;)
+        {
+            if (!_idleReaders.empty())
+            {
+                std::unique_ptr<archive_set> archives = std::move(_idleReaders.back());
+                _idleReaders.pop_back();
+                return archives;
+            }
+
+            if (_readerCount < _maxReaders)
+            {
+                ++_readerCount;
+
+                // Opening archives reads their tables from disk; let other readers come and go meanwhile.
+                lock.unlock();
+                std::unique_ptr<archive_set> archives = OpenArchives();
+                lock.lock();
+
+                if (archives != nullptr)
+                    return archives;
+
+                // Out of file handles or memory; make do with the readers already open.
+                --_readerCount;
+                _maxReaders = std::max<size_t>(_readerCount, 1);
+                continue;
+            }
+
+            _readerReleased.wait(lock);
+        }
+    }
+
+    void mpq_file_system::ReleaseReader(std::unique_ptr<archive_set> archives) const
+    {
+        {
+            std::lock_guard<std::mutex> lock(_readerLock);
+            if (_readerCount > _maxReaders)
+            {
+                --_readerCount;
+                CloseArchives(*archives);
+                return;
+            }
+
+            _idleReaders.push_back(std::move(archives));
+        }
+
+        _readerReleased.notify_one();
+    }
+
+    mpq_file_system::reader_lease::reader_lease(mpq_file_system const& fileSystem)
+        : _fileSystem(fileSystem), _archives(fileSystem.AcquireReader())
+    {
+    }
+
+    mpq_file_system::reader_lease::~reader_lease()
+    {
+        _fileSystem.ReleaseReader(std::move(_archives));
+    }
+
+    void mpq_file_system::SetMaxReaders(size_t readerCount)
+    {
+        std::lock_guard<std::mutex> lock(_readerLock);
+        _maxReaders = std::max<size_t>(readerCount, 1);
+
+        // Readers in use are closed as they come back.
+        while (_readerCount > _maxReaders && !_idleReaders.empty())
+        {
+            CloseArchives(*_idleReaders.back());
+            _idleReaders.pop_back();
+            --_readerCount;
+        }
+
+        _readerReleased.notify_all();
+    }
+
+    mpq_file_system::~mpq_file_system()
+    {
+        std::unique_lock<std::shared_mutex> lock(_stateLock);
+        std::lock_guard<std::mutex> readerLock(_readerLock);
+
+        for (std::unique_ptr<archive_set>& archives : _idleReaders)
+            CloseArchives(*archives);
+
+        _idleReaders.clear();
+        _readerCount = 0;
+    }
+
+    uint64_t mpq_file_system::GetContentStamp() const
+    {
+        std::shared_lock<std::shared_mutex> lock(_stateLock);
+        return _contentStamp;
+    }
+
+    mpq_index_statistics mpq_file_system::GetIndexStatistics() const
+    {
+        std::shared_lock<std::shared_mutex> lock(_stateLock);
+        return _indexStatistics;
+    }
+
+    std::vector<std::string> mpq_file_system::GetFileNames() const
+    {
+        std::shared_lock<std::shared_mutex> lock(_stateLock);
+
+        std::vector<std::string> fileNames;
+        fileNames.reserve(_fileIndex.size());
+        for (auto&& entry : _fileIndex)
+            fileNames.push_back(entry.first);
+        return fileNames;
     }
 
     std::shared_ptr<mpq_file> mpq_file_system::OpenFile(const std::string& filePath)
     {
-        for (HANDLE archiveHandle : _archiveHandles)
+        return OpenFile(filePath, mpq_cache_policy::use);
+    }
+
+    std::shared_ptr<mpq_file> mpq_file_system::OpenFile(const std::string& filePath, mpq_cache_policy cachePolicy)
+    {
+        std::shared_lock<std::shared_mutex> lock(_stateLock);
+        if (_archivePaths.empty())
+            return { };
+
+        // StormLib hashes names the same way the index normalizes them.
+        std::string normalizedPath = NormalizePath(filePath);
+
+        if (cachePolicy == mpq_cache_policy::use)
+            if (mpq_file_cache::contents_ptr fileData = _cache.Find(normalizedPath))
+                return std::shared_ptr<mpq_file>(new mpq_file(std::move(fileData)));
+
+        std::shared_ptr<mpq_file> file;
         {
+            // The whole file is read and the StormLib handle closed before the lease ends.
+            reader_lease archives(*this);
+
+            uint32_t archiveIndex = FindArchive(normalizedPath, *archives);
+            if (archiveIndex == npos)
+                return { };
+
             HANDLE fileHandle;
-            if (SFileOpenFileEx(archiveHandle, filePath.c_str(), SFILE_OPEN_PATCHED_FILE, &fileHandle))
-                return std::shared_ptr<mpq_file>(new mpq_file(fileHandle));
+            if (!SFileOpenFileEx((*archives)[archiveIndex], normalizedPath.c_str(), SFILE_OPEN_PATCHED_FILE, &fileHandle))
+                return { };
+
+            file.reset(new mpq_file(fileHandle));
         }
 
-        return { };
+        if (cachePolicy == mpq_cache_policy::use)
+            file->_fileData = _cache.Insert(normalizedPath, std::move(file->_fileData));
+
+        return file;
     }
 
-    bool mpq_file_system::FileExists(const std::string& relFilePath) const
+    std::shared_ptr<mpq_stream> mpq_file_system::OpenStream(const std::string& filePath)
     {
-        for (HANDLE archiveHandle : _archiveHandles)
+        std::shared_lock<std::shared_mutex> lock(_stateLock);
+        if (_archivePaths.empty())
+            return { };
+
+        std::string normalizedPath = NormalizePath(filePath);
+
+        if (mpq_file_cache::contents_ptr fileData = _cache.Find(normalizedPath))
+            return std::shared_ptr<mpq_stream>(new mpq_stream(std::move(fileData)));
+
+        reader_lease archives(*this);
+
+        uint32_t archiveIndex = FindArchive(normalizedPath, *archives);
+        if (archiveIndex == npos)
+            return { };
+
+        HANDLE fileHandle;
+        if (!SFileOpenFileEx((*archives)[archiveIndex], normalizedPath.c_str(), SFILE_OPEN_PATCHED_FILE, &fileHandle))
+            return { };
+
+        DWORD fileSize = SFileGetFileSize(fileHandle, nullptr);
+        SFileCloseFile(fileHandle);
+
+        if (fileSize == SFILE_INVALID_SIZE)
+            return { };
+
+        return std::shared_ptr<mpq_stream>(new mpq_stream(*this, std::move(normalizedPath), archiveIndex, _contentStamp, fileSize));
+    }
+
+    size_t mpq_file_system::ReadRange(const std::string& filePath, uint32_t archiveIndex, uint64_t contentStamp, size_t offset, size_t length, uint8_t* buffer) const
+    {
+        std::shared_lock<std::shared_mutex> lock(_stateLock);
+        if (contentStamp != _contentStamp || archiveIndex >= _archivePaths.size())
+            return 0;
+
+        // File handles are tied to the archive handle they were opened from, which another thread may use next.
+        reader_lease archives(*this);
+
+        HANDLE fileHandle;
+        if (!SFileOpenFileEx((*archives)[archiveIndex], filePath.c_str(), SFILE_OPEN_PATCHED_FILE, &fileHandle))
+            return 0;
+
+        LONG offsetHigh = LONG(uint64_t(offset) >> 32);
+        DWORD bytesRead = 0;
+        if (SFileSetFilePointer(fileHandle, LONG(offset & 0xFFFFFFFFu), &offsetHigh, FILE_BEGIN) != SFILE_INVALID_POS)
         {
-            HANDLE fileHandle;
-            if (SFileOpenFileEx(archiveHandle, relFilePath.c_str(), SFILE_OPEN_PATCHED_FILE, &fileHandle))
-            {
-                SFileCloseFile(archiveHandle);
-                return true;
-            }
+            // Fails with ERROR_HANDLE_EOF on a short read, which still reports what it read.
+            SFileReadFile(fileHandle, buffer, DWORD(length), &bytesRead, nullptr);
         }
 
-        return false;
+        SFileCloseFile(fileHandle);
+        return bytesRead;
     }
 
-    mpq_file::mpq_file(HANDLE fileHandle)
+    void mpq_file_system::SetCacheBudget(size_t budget)
     {
-        _fileHandle = fileHandle;
+        _cache.SetBudget(budget);
+    }
+
+    mpq_cache_statistics mpq_file_system::GetCacheStatistics() const
+    {
+        return _cache.GetStatistics();
+    }
 
-        _fileData.resize(GetFileSize());
-        if (!SFileReadFile(_fileHandle, _fileData.data(), GetFileSize()))
+    bool mpq_file_system::FileExists(const std::string& relFilePath) const
+    {
+        std::shared_lock<std::shared_mutex> lock(_stateLock);
+        if (_archivePaths.empty())
+            return false;
+
+        // Only archives without a listfile need a handle to be searched.
+        if (_unlistedArchives.empty())
+            return _fileIndex.find(NormalizePath(relFilePath)) != _fileIndex.end();
+
+        reader_lease archives(*this);
+        return FindArchive(relFilePath, *archives) != npos;
+    }
+
+    mpq_file::mpq_file(HANDLE fileHandle) : _fileHandle(fileHandle)
+    {
+        _fileData = std::make_shared<std::vector<uint8_t>>(SFileGetFileSize(_fileHandle, nullptr));
+        if (!SFileReadFile(_fileHandle, _fileData->data(), DWORD(_fileData->size())))
             shared::assert::throw_with_trace("Unable to read file");
 
         // Immediately close the handle, but don't call Close() - this would clear the buffer
@@ -99,6 +434,10 @@ namespace shared::filesystem
         _fileHandle = nullptr;
     }
 
+    mpq_file::mpq_file(mpq_file_cache::contents_ptr fileData) : _fileHandle(nullptr), _fileData(std::move(fileData))
+    {
+    }
+
     mpq_file::~mpq_file()
     {
         Close();
@@ -106,7 +445,7 @@ namespace shared::filesystem
 
     void mpq_file::Close()
     {
-        _fileData.clear();
+        _fileData.reset();
 
         if (_fileHandle == nullptr)
             return;
@@ -117,22 +456,86 @@ namespace shared::filesystem
 
     size_t mpq_file::GetFileSize() const
     {
-        return SFileGetFileSize(_fileHandle);
+        return _fileData != nullptr ? _fileData->size() : 0;
     }
 
     uint8_t const* mpq_file::GetData()
     {
-        return _fileData.data();
+        return _fileData != nullptr ? _fileData->data() : nullptr;
+    }
+
+    std::vector<uint8_t> mpq_file::ReleaseData()
+    {
+        if (_fileData == nullptr)
+            return { };
+
+        std::vector<uint8_t> fileData = _fileData.use_count() == 1 ? std::move(*_fileData) : *_fileData;
+        _fileData.reset();
+        return fileData;
     }
 
     size_t mpq_file::ReadBytes(size_t offset, size_t length, uint8_t* buffer, size_t bufferSize)
     {
-        auto availableDataLength = GetFileSize() - offset;
-        if (bufferSize < availableDataLength)
-            availableDataLength = bufferSize;
+        size_t fileSize = GetFileSize();
+        if (offset >= fileSize)
+            return 0;
+
+        length = std::min({ length, bufferSize, fileSize - offset });
+        memcpy(buffer, GetData() + offset, length);
+        return length;
+    }
+
+    mpq_stream::mpq_stream(mpq_file_system const& fileSystem, std::string filePath, uint32_t archiveIndex, uint64_t contentStamp, size_t fileSize)
+        : _fileSystem(&fileSystem), _filePath(std::move(filePath)), _archiveIndex(archiveIndex), _contentStamp(contentStamp), _fileSize(fileSize)
+    {
+    }
+
+    mpq_stream::mpq_stream(mpq_file_cache::contents_ptr fileData) : _fileSize(fileData->size()), _fileData(std::move(fileData))
+    {
+    }
+
+    size_t mpq_stream::GetFileSize() const
+    {
+        return _fileSize;
+    }
+
+    void mpq_stream::SetReadAhead(size_t byteCount)
+    {
+        _readAhead = byteCount;
+        _readAheadBuffer.clear();
+        _readAheadBuffer.shrink_to_fit();
+    }
+
+    size_t mpq_stream::ReadBytes(size_t offset, size_t length, uint8_t* buffer, size_t bufferSize)
+    {
+        if (offset >= _fileSize)
+            return 0;
+
+        length = std::min({ length, bufferSize, _fileSize - offset });
+        if (length == 0)
+            return 0;
+
+        if (_fileData != nullptr)
+        {
+            memcpy(buffer, _fileData->data() + offset, length);
+            return length;
+        }
+
+        if (offset >= _readAheadOffset && offset + length <= _readAheadOffset + _readAheadBuffer.size())
+        {
+            memcpy(buffer, _readAheadBuffer.data() + (offset - _readAheadOffset), length);
+            return length;
+        }
+
+        if (length >= _readAhead)
+            return _fileSystem->ReadRange(_filePath, _archiveIndex, _contentStamp, offset, length, buffer);
 
-        memcpy(buffer, _fileData.data() + offset, availableDataLength);
+        _readAheadBuffer.resize(std::min(_readAhead, _fileSize - offset));
+        _readAheadBuffer.resize(_fileSystem->ReadRange(_filePath, _archiveIndex, _contentStamp, offset, _readAheadBuffer.size(), _readAheadBuffer.data()));
+        _readAheadOffset = offset;
 
-        return availableDataLength;
+        length = std::min(length, _readAheadBuffer.size());
+        memcpy(buffer, _readAheadBuffer.data(), length);
+        return length;
     }
 }
@@ -1,12 +1,18 @@
 #pragma once
 
+#include <chrono>
+#include <condition_variable>
 #include <string>
 #include <vector>
 #include <memory>
 #include <mutex>
+#include <shared_mutex>
 
 #include <shared/defines.hpp>
 #include <shared/filesystem/file_system.hpp>
+#include <shared/filesystem/mpq_file_cache.hpp>
+
+#include <extstd/containers/flat_hash_map.hpp>
 
 #include <windows.h>
 
@@ -20,8 +26,12 @@ namespace shared::filesystem
 
         using Basefile_handle = file_handle<mpq_file>;
 
+        /// Reads and decompresses the whole file, then closes {@param fileHandle}.
         mpq_file(HANDLE fileHandle);
 
+        /// Shares contents already decompressed, typically by the cache.
+        mpq_file(mpq_file_cache::contents_ptr fileData);
+
     public:
         ~mpq_file();
 
@@ -30,14 +40,103 @@ namespace shared::filesystem
         uint8_t const* GetData() override;
         size_t ReadBytes(size_t offset, size_t length, uint8_t* buffer, size_t bufferSize) override;
 
+        /// Hands the decompressed contents over to the caller, leaving this handle empty. Copies them if they are shared.
+        std::vector<uint8_t> ReleaseData();
+
     private:
         HANDLE _fileHandle;
 
-        std::vector<uint8_t> _fileData;
+        /// Never written to once the file is open: the cache may share it with other files.
+        mpq_file_cache::contents_ptr _fileData;
+    };
+
+    /**
+     * Reads ranges of an MPQ file on demand, decompressing only the sectors they cover, for large files of which only
+     * a header or a few chunks are needed. Every read borrows archive handles from the file system for its duration,
+     * so streams can be held for as long as needed. Streams themselves must not be shared between threads.
+     *
+     * A stream opened on a file already in the cache reads from the cached contents instead.
+     */
+    class mpq_stream final
+    {
+        friend class mpq_file_system;
+
+        mpq_stream(mpq_file_system const& fileSystem, std::string filePath, uint32_t archiveIndex, uint64_t contentStamp, size_t fileSize);
+        mpq_stream(mpq_file_cache::contents_ptr fileData);
+
+    public:
+        size_t GetFileSize() const;
+
+        /**
+         * Copies up to {@param length} bytes starting at {@param offset}, never more than {@param bufferSize}, and returns how many
+         * were copied. Zero past the end of the file, or if the archives were reloaded since the stream was opened.
+         */
+        size_t ReadBytes(size_t offset, size_t length, uint8_t* buffer, size_t bufferSize);
+
+        /**
+         * Reads shorter than {@param byteCount} fetch that many bytes at once and serve the following reads from them,
+         * which saves sequential parsers one archive access per field. Best kept a multiple of the archive sector size.
+         * Zero, the default, disables read-ahead.
+         */
+        void SetReadAhead(size_t byteCount);
+
+    private:
+        mpq_file_system const* _fileSystem = nullptr;
+        std::string _filePath;
+        uint32_t _archiveIndex = 0;
+        uint64_t _contentStamp = 0;
+        size_t _fileSize = 0;
+
+        mpq_file_cache::contents_ptr _fileData;
+
+        size_t _readAhead = 0;
+        std::vector<uint8_t> _readAheadBuffer;
+        size_t _readAheadOffset = 0;
+    };
+
+    /// Whether {@link mpq_file_system::OpenFile} goes through the cache of decompressed files.
+    enum class mpq_cache_policy
+    {
+        use,
+        /// For files read once and then adopted, like client databases; a cached copy would only take room.
+        bypass
+    };
+
+    struct mpq_index_statistics
+    {
+        size_t archiveCount = 0;
+        size_t fileCount = 0;
+        /// Archives without a listfile, which lookups have to probe one by one.
+        size_t unlistedArchiveCount = 0;
+        std::chrono::microseconds buildTime{ 0 };
+        /// Approximate heap usage of the index.
+        size_t memoryUsage = 0;
     };
 
     class mpq_file_system final : public file_system<mpq_file>
     {
+        friend class mpq_stream;
+
+        /// One handle per loaded archive, in load order. StormLib handles must not be used by two threads at once.
+        using archive_set = std::vector<HANDLE>;
+
+        /// Borrows an archive set from the pool for as long as it lives.
+        class reader_lease final
+        {
+        public:
+            explicit reader_lease(mpq_file_system const& fileSystem);
+            ~reader_lease();
+
+            reader_lease(reader_lease const&) = delete;
+            reader_lease& operator = (reader_lease const&) = delete;
+
+            archive_set const& operator * () const { return *_archives; }
+
+        private:
+            mpq_file_system const& _fileSystem;
+            std::unique_ptr<archive_set> _archives;
+        };
+
     public:
         static mpq_file_system* Instance()
         {
@@ -50,11 +149,83 @@ namespace shared::filesystem
 
         void Initialize(const std::string& rootFolder) override;
         std::shared_ptr<mpq_file> OpenFile(const std::string& filePath) override;
+        std::shared_ptr<mpq_file> OpenFile(const std::string& filePath, mpq_cache_policy cachePolicy);
+
+        /// Opens {@param filePath} without reading it. Returns nullptr if no archive holds it.
+        std::shared_ptr<mpq_stream> OpenStream(const std::string& filePath);
 
         bool FileExists(const std::string& relFilePath) const override;
 
+        /**
+         * Identifies the set of loaded archives by their paths, sizes and modification times, so that anything
+         * derived from their contents can be invalidated when a patch lands. Zero if no archive is loaded.
+         */
+        uint64_t GetContentStamp() const;
+
+        mpq_index_statistics GetIndexStatistics() const;
+
+        /// Normalized names of every file in the index.
+        std::vector<std::string> GetFileNames() const;
+
+        /**
+         * Lets up to {@param readerCount} threads read files at once, each through its own handle to every archive.
+         * Extra handles are opened on demand and kept; each one holds a copy of the archive's hash and block tables,
+         * which is why this defaults to a single reader.
+         */
+        void SetMaxReaders(size_t readerCount);
+
+        /// Bytes of decompressed files kept around for the next time they are opened. Zero disables the cache.
+        void SetCacheBudget(size_t budget);
+        mpq_cache_statistics GetCacheStatistics() const;
+
+        constexpr static const size_t DefaultCacheBudget = size_t(64) << 20;
+
+        /// Upper-cases {@param filePath} and turns slashes into backslashes, which is how the index names files.
+        static std::string NormalizePath(const std::string& filePath);
+
+        constexpr static const uint32_t npos = 0xFFFFFFFFu;
+
     private:
-        std::vector<HANDLE> _archiveHandles;
+        /// Maps every file listed by the archives to the first archive holding it, in load order.
+        void BuildIndex(archive_set const& archives);
+
+        /// Index in load order of the archive holding {@param filePath}, or {@link npos}.
+        uint32_t FindArchive(const std::string& filePath, archive_set const& archives) const;
+
+        /// Opens a handle to every archive in {@link _archivePaths}. Returns nullptr if any of them fails to open.
+        std::unique_ptr<archive_set> OpenArchives() const;
+        static void CloseArchives(archive_set& archives);
+
+        /**
+         * Reads {@param length} bytes at {@param offset} of the file {@param filePath} of the archive {@param archiveIndex}
+         * into {@param buffer}, returning how many were read. Zero if the archives loaded don't match {@param contentStamp}.
+         */
+        size_t ReadRange(const std::string& filePath, uint32_t archiveIndex, uint64_t contentStamp, size_t offset, size_t length, uint8_t* buffer) const;
+
+        std::unique_ptr<archive_set> AcquireReader() const;
+        void ReleaseReader(std::unique_ptr<archive_set> archives) const;
+
+        /// Held exclusively while archives are (re)loaded, shared by everything that reads them.
+        mutable std::shared_mutex _stateLock;
+
+        std::vector<std::basic_string<TCHAR>> _archivePaths;
+        /// Indices into {@link _archivePaths} of the archives without a listfile, in load order.
+        std::vector<uint32_t> _unlistedArchives;
+
+        /// Normalized path to the index of the first archive holding it, which is also its priority: lower wins.
+        extstd::containers::flat_hash_map<std::string, uint32_t> _fileIndex;
+        mpq_index_statistics _indexStatistics;
+
         std::string _currentRootFolder;
+        uint64_t _contentStamp = 0;
+
+        mpq_file_cache _cache{ DefaultCacheBudget };
+
+        // Archive sets not lent to a reader. Every set is idle whenever _stateLock is held exclusively.
+        mutable std::mutex _readerLock;
+        mutable std::condition_variable _readerReleased;
+        mutable std::vector<std::unique_ptr<archive_set>> _idleReaders;
+        mutable size_t _readerCount = 0;
+        mutable size_t _maxReaders = 1;
     };
 }
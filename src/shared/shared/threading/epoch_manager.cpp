@@ -0,0 +1,125 @@
+#include <shared/threading/epoch_manager.hpp>
+#include <shared/assert/assert.hpp>
+
+#include <limits>
+#include <vector>
+
+namespace shared::threading
+{
+    struct thread_record
+    {
+        epoch_manager::slot* threadSlot = nullptr;
+        uint32_t depth = 0;
+
+        ~thread_record()
+        {
+            if (threadSlot != nullptr)
+                epoch_manager::instance()->release_slot(threadSlot);
+        }
+    };
+
+    namespace
+    {
+        thread_local thread_record t_record;
+    }
+
+    epoch_manager::epoch_manager() : _epoch(1)
+    {
+
+    }
+
+    epoch_manager* epoch_manager::instance()
+    {
+        static epoch_manager instance;
+        return &instance;
+    }
+
+    auto epoch_manager::acquire_slot() -> slot*
+    {
+        for (slot& threadSlot : _slots)
+        {
+            bool expected = false;
+            if (threadSlot.owned.compare_exchange_strong(expected, true, std::memory_order_acq_rel))
+                return &threadSlot;
+        }
+
+        BOOST_ASSERT_MSG(false, "Too many threads are pinning epochs");
+        return nullptr;
+    }
+
+    void epoch_manager::release_slot(slot* threadSlot)
+    {
+        threadSlot->epoch.store(0, std::memory_order_release);
+        threadSlot->owned.store(false, std::memory_order_release);
+    }
+
+    void epoch_manager::enter()
+    {
+        if (t_record.depth++ != 0)
+            return;
+
+        if (t_record.threadSlot == nullptr)
+            t_record.threadSlot = acquire_slot();
+
+        // Pinning a stale epoch is harmless, it only delays reclamation. What matters is that the pin is
+        // visible before any shared pointer is loaded.
+        t_record.threadSlot->epoch.store(_epoch.load(std::memory_order_acquire), std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+    }
+
+    void epoch_manager::leave()
+    {
+        BOOST_ASSERT_MSG(t_record.depth != 0, "epoch_manager::leave() called without a matching enter()");
+
+        if (--t_record.depth == 0)
+            t_record.threadSlot->epoch.store(0, std::memory_order_release);
+    }
+
+    void epoch_manager::retire(std::function<void()> reclaimer)
+    {
+        std::lock_guard<std::mutex> lock(_retiredLock);
+
+        // Readers pinning after this point will see the new epoch, and cannot have observed what was unlinked.
+        uint64_t retireEpoch = _epoch.fetch_add(1, std::memory_order_seq_cst);
+        _retired.emplace_back(retireEpoch, std::move(reclaimer));
+    }
+
+    size_t epoch_manager::collect()
+    {
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+
+        uint64_t oldestPinned = std::numeric_limits<uint64_t>::max();
+        for (slot& threadSlot : _slots)
+        {
+            if (!threadSlot.owned.load(std::memory_order_acquire))
+                continue;
+
+            uint64_t pinned = threadSlot.epoch.load(std::memory_order_acquire);
+            if (pinned != 0 && pinned < oldestPinned)
+                oldestPinned = pinned;
+        }
+
+        std::vector<std::function<void()>> reclaimers;
+        {
+            std::lock_guard<std::mutex> lock(_retiredLock);
+
+            // Epochs are handed out in order, so the queue is sorted.
+            while (!_retired.empty() && _retired.front().first < oldestPinned)
+            {
+                reclaimers.push_back(std::move(_retired.front().second));
+                _retired.pop_front();
+            }
+        }
+
+        for (std::function<void()>& reclaimer : reclaimers)
+            reclaimer();
+
+        return reclaimers.size();
+    }
+
+    size_t epoch_manager::pending()
+    {
+        std::lock_guard<std::mutex> lock(_retiredLock);
+        return _retired.size();
+    }
+}
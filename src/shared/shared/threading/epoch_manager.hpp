@@ -0,0 +1,78 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <utility>
+
+namespace shared::threading
+{
+    /**
+     * Epoch-based memory reclamation.
+     *
+     * Readers pin the current epoch for as long as they dereference shared pointers, by holding an
+     * {@link epoch_guard}. Writers unlink an object so that no new reader can reach it, then hand
+     * it to retire(). Retired objects are reclaimed by collect() once every reader that could still
+     * see them has unpinned.
+     *
+     * Pinning is wait-free; retire() and collect() take a lock, but readers never do.
+     */
+    class epoch_manager final
+    {
+        epoch_manager();
+
+    public:
+        static constexpr size_t max_threads = 64;
+
+        static epoch_manager* instance();
+
+        /// Pins the current epoch on the calling thread. Calls nest.
+        void enter();
+        void leave();
+
+        /// Schedules {@param reclaimer} to run once no reader can still observe what it frees.
+        void retire(std::function<void()> reclaimer);
+
+        /**
+         * Runs every reclaimer that has become safe to run, on the calling thread.
+         *
+         * @returns The number of reclaimers that ran.
+         */
+        size_t collect();
+
+        /// Number of reclaimers still waiting on readers.
+        size_t pending();
+
+    private:
+        struct alignas(64) slot
+        {
+            std::atomic<uint64_t> epoch{ 0 }; // 0 when the owning thread is not pinned
+            std::atomic<bool> owned{ false };
+        };
+
+        slot* acquire_slot();
+        void release_slot(slot* threadSlot);
+
+        friend struct thread_record;
+
+        std::atomic<uint64_t> _epoch;
+        std::array<slot, max_threads> _slots;
+
+        std::mutex _retiredLock;
+        std::deque<std::pair<uint64_t, std::function<void()>>> _retired;
+    };
+
+    /// Pins the current epoch for the lifetime of the guard.
+    class epoch_guard final
+    {
+    public:
+        epoch_guard() { epoch_manager::instance()->enter(); }
+        ~epoch_guard() { epoch_manager::instance()->leave(); }
+
+        epoch_guard(epoch_guard const&) = delete;
+        epoch_guard& operator = (epoch_guard const&) = delete;
+    };
+}
@@ -9,11 +9,22 @@
 #include <future>
 #include <functional>
 #include <stdexcept>
+#include <type_traits>
+#include <algorithm>
 
 #include <extstd/threading/join_all.hpp>
 
 namespace shared::threading
 {
+    /**
+     * A fixed-size pool of worker threads consuming a shared FIFO queue of tasks.
+     *
+     * Tasks already queued when the pool is destroyed still run; the destructor blocks until every worker is done.
+     * Exceptions thrown by a task are stored in the future returned by {@link submit}.
+     *
+     * Tasks must not block on the future of another task submitted to the same pool, since every worker may end
+     * up waiting on work that is queued behind it.
+     */
     class thread_pool
     {
     public:
@@ -22,70 +33,124 @@ namespace shared::threading
 
         ~thread_pool();
 
+        thread_pool(thread_pool&&) = delete;
+        thread_pool(thread_pool const&) = delete;
+
         template <typename F, typename... Args>
-        auto submit(F&& function, Args&&... args) -> std::future<typename std::result_of<F(Args...)>::type>;
+        auto submit(F&& function, Args&&... args) -> std::future<std::invoke_result_t<std::decay_t<F>, std::decay_t<Args>...>>;
+
+        /// Blocks until the queue is empty and no worker is running a task.
+        void wait_idle();
+
+        size_t size() const { return _workers.size(); }
+
+        /// Worker count used by the default constructor: one per hardware thread, minus the caller's.
+        static size_t default_size();
 
     private:
+        void run();
+        void stop();
+
         std::vector<std::thread> _workers;
         std::queue<std::function<void()>> _queue;
 
         std::mutex _queueMutex;
         std::condition_variable _condition;
-        std::atomic_bool _stop;
+        std::condition_variable _idleCondition;
+        size_t _activeTasks = 0;
+        bool _stop = false;
     };
 
-    thread_pool::~thread_pool()
+    inline size_t thread_pool::default_size()
+    {
+        // hardware_concurrency() is allowed to return 0.
+        unsigned int hardwareThreads = std::thread::hardware_concurrency();
+        return hardwareThreads > 1 ? size_t(hardwareThreads - 1) : size_t(1);
+    }
+
+    inline thread_pool::thread_pool() : thread_pool(default_size())
     {
-        while (!_queue.empty())
-            _queue.pop();
 
-        _stop.exchange(true);
+    }
+
+    inline thread_pool::thread_pool(size_t threads)
+    {
+        _workers.reserve(std::max(threads, size_t(1)));
+
+        try {
+            for (size_t i = 0; i < std::max(threads, size_t(1)); ++i)
+                _workers.emplace_back([this]() -> void { run(); });
+        }
+        catch (...) {
+            // Threads that did start must be joined before they are destroyed.
+            stop();
+            throw;
+        }
+    }
+
+    inline thread_pool::~thread_pool()
+    {
+        stop();
+    }
+
+    inline void thread_pool::stop()
+    {
+        {
+            std::unique_lock<std::mutex> lock(_queueMutex);
+            _stop = true;
+        }
 
         _condition.notify_all();
         extstd::threading::join_all(_workers);
+        _workers.clear();
     }
 
-    thread_pool::thread_pool() : thread_pool(std::max(std::thread::hardware_concurrency() - 1, 1u))
+    inline void thread_pool::run()
     {
+        for (;;)
+        {
+            std::function<void()> task;
+
+            {
+                std::unique_lock<std::mutex> lock(_queueMutex);
+
+                _condition.wait(lock, [this]() { return _stop || !_queue.empty(); });
+                if (_stop && _queue.empty())
+                    return;
 
+                task = std::move(_queue.front());
+                _queue.pop();
+                ++_activeTasks;
+            }
+
+            task();
+
+            {
+                std::unique_lock<std::mutex> lock(_queueMutex);
+                if (--_activeTasks == 0 && _queue.empty())
+                    _idleCondition.notify_all();
+            }
+        }
     }
 
-    inline thread_pool::thread_pool(size_t threads) : _stop(false)
+    inline void thread_pool::wait_idle()
     {
-        for (size_t i = 0; i < threads; ++i)
-            _workers.emplace_back([this]() -> void {
-                for (;;)
-                {
-                    std::function<void()> task;
-
-                    {
-                        std::unique_lock<std::mutex> lock(this->_queueMutex);
-
-                        this->_condition.wait(lock, [this]() { return this->_stop || !this->_queue.empty(); });
-                        if (this->_stop && this->_queue.empty())
-                            return;
-
-                        task = std::move(this->_queue.front());
-                        this->_queue.pop();
-                    }
-
-                    task();
-                }
-        });
+        std::unique_lock<std::mutex> lock(_queueMutex);
+        _idleCondition.wait(lock, [this]() { return _queue.empty() && _activeTasks == 0; });
     }
 
     template <typename F, typename... Args>
-    auto thread_pool::submit(F&& function, Args&&... args) -> std::future<typename std::result_of<F(Args...)>::type>
+    auto thread_pool::submit(F&& function, Args&&... args) -> std::future<std::invoke_result_t<std::decay_t<F>, std::decay_t<Args>...>>
     {
-        using return_type = typename std::result_of<F(Args...)>::type;
+        using return_type = std::invoke_result_t<std::decay_t<F>, std::decay_t<Args>...>;
 
-        auto task = std::make_shared<std::packaged_task<return_type()>>(std::bind(std::forward<F>(f), std::forward<Args>(args)...));
+        auto task = std::make_shared<std::packaged_task<return_type()>>(std::bind(std::forward<F>(function), std::forward<Args>(args)...));
 
         auto future = task->get_future();
         {
             std::unique_lock<std::mutex> lock(_queueMutex);
             if (_stop)
-                return;
+                throw std::runtime_error("submit() called on a stopped thread_pool");
 
             _queue.emplace([task]() -> void {
                 (*task)();
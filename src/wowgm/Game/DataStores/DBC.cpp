@@ -4,362 +4,1410 @@
 #include "DBCMeta.hpp"
 #include "DBTraits.hpp"
 #include "DBStorage.hpp"
+#include "Utils.hpp"
 
 #include <cstdint>
 #include <cstddef>
+#include <cstring>
+#include <algorithm>
 #include <chrono>
+#include <future>
+#include <ostream>
+#include <random>
+#include <string>
+#include <vector>
 
+#include <shared/filesystem/mpq_file_system.hpp>
 #include <shared/log/log.hpp>
+#include <shared/threading/thread_pool.hpp>
 
-// AUTOGENERATED FILE - DO NOT EDIT
-// See contrib/dbmeta.py
+// Maintained by hand; contrib/dbmeta.py only generates the table metadata in DBCMeta.hpp.
+// ForEachTable lists every table of DBCMeta.hpp and must be kept in sync with it.
 namespace wowgm::game::datastores
 {
     namespace DataStores
     {
-        void Initialize()
+        namespace
         {
             using hrc = std::chrono::high_resolution_clock;
 
+            struct TableLoadTime
+            {
+                const char* Name;
+                uint32_t RecordCount;
+                std::chrono::microseconds Duration;
+            };
+
+            /**
+             * Loads tables concurrently. Tables share no state besides the MPQ file system, which serializes
+             * archive reads unless it was given more readers; decoding and indexing run in parallel.
+             */
+            struct TableLoader
+            {
+                shared::threading::thread_pool& Pool;
+                std::vector<std::future<TableLoadTime>> Pending{};
+
+                template <typename T>
+                void Load()
+                {
+                    Pending.push_back(Pool.submit([]() -> TableLoadTime {
+                        auto start = hrc::now();
+                        Storage<T>::Load();
+                        auto duration = std::chrono::duration_cast<std::chrono::microseconds>(hrc::now() - start);
+
+                        TableLoadTime loadTime{ Storage<T>::meta_t::name(), Storage<T>::GetRecordCount(), duration };
+                        LOG_INFO("Loaded {} records from {} in {} ms", loadTime.RecordCount, loadTime.Name, loadTime.Duration.count() / 1000.0f);
+                        return loadTime;
+                    }));
+                }
+
+                /// Waits for every table and returns the summed per-table time.
+                std::chrono::microseconds Wait()
+                {
+                    std::chrono::microseconds total(0);
+                    for (std::future<TableLoadTime>& future : Pending)
+                        total += future.get().Duration;
+
+                    Pending.clear();
+                    return total;
+                }
+            };
+
+            shared::threading::thread_pool& GetLoaderPool()
+            {
+                static shared::threading::thread_pool pool;
+                return pool;
+            }
+
+            /**
+             * Decodes every table the MPQ archives hold with both the unrolled decoder and the runtime one it
+             * replaced, without touching the loaded storages.
+             */
+            struct DecodeBenchmark
+            {
+                std::ostream& Output;
+                uint32_t Iterations;
+
+                std::chrono::microseconds GenericTotal{ 0 };
+                std::chrono::microseconds UnrolledTotal{ 0 };
+
+                template <typename T>
+                void Visit()
+                {
+                    using meta_t = typename Storage<T>::meta_t;
+                    using header_type = typename Storage<T>::header_type;
+
+                    std::string filePath = "DBFilesClient\\";
+                    filePath += meta_t::name();
+
+                    auto fileHandle = mpq_file_system::Instance()->OpenFile(filePath, mpq_cache_policy::bypass);
+                    if (fileHandle == nullptr || fileHandle->GetData() == nullptr || fileHandle->GetFileSize() < sizeof(header_type))
+                        return;
+
+                    header_type header;
+                    memcpy(&header, fileHandle->GetData(), sizeof(header_type));
+
+                    size_t recordOffset = Storage<T>::GetRecordOffset(header);
+                    if (header.RecordCount == 0 || recordOffset + size_t(header.RecordCount) * meta_t::record_size > fileHandle->GetFileSize())
+                        return;
+
+                    uint8_t const* data = fileHandle->GetData() + recordOffset;
+                    uint8_t const* strings = data + size_t(header.RecordCount) * meta_t::record_size;
+
+                    std::vector<T> records(header.RecordCount);
+                    uint8_t* target = reinterpret_cast<uint8_t*>(records.data());
+
+                    auto measure = [this](auto&& decode) {
+                        auto start = hrc::now();
+                        for (uint32_t i = 0; i < Iterations; ++i)
+                            decode();
+                        return std::chrono::duration_cast<std::chrono::microseconds>(hrc::now() - start);
+                    };
+
+                    std::chrono::microseconds generic = measure([&]() {
+                        for (uint32_t i = 0; i < header.RecordCount; ++i)
+                            detail::decode_record_generic<meta_t>(target + i * sizeof(T), data + size_t(i) * meta_t::record_size, strings);
+                    });
+
+                    std::chrono::microseconds unrolled = measure([&]() {
+                        detail::record_decoder<meta_t>::DecodeBlock(target, sizeof(T), data, header.RecordCount, strings);
+                    });
+
+                    GenericTotal += generic;
+                    UnrolledTotal += unrolled;
+
+                    Output << meta_t::name() << ": " << header.RecordCount << " records, "
+                        << generic.count() / double(Iterations) << " us generic, "
+                        << unrolled.count() / double(Iterations) << " us unrolled, x"
+                        << generic.count() / std::max(1.0, double(unrolled.count()));
+
+                    if constexpr (Storage<T>::is_mapped)
+                        Output << " (mapped, not decoded at load)";
+                    else if constexpr (detail::is_block_copyable<meta_t>())
+                        Output << " (block copy)";
+
+                    Output << std::endl;
+                }
+            };
+
+            /// Most records {@link MakeSyntheticFile} can give distinct IDs for, given the width of the index column of {@param T}.
+            template <typename T>
+            constexpr uint32_t GetSyntheticRecordLimit()
+            {
+                using meta_t = typename Storage<T>::meta_t;
+
+                uint32_t indexSize = std::min<uint32_t>(meta_t::field_sizes[meta_t::index_column], sizeof(uint32_t));
+                return 1u << (8u * indexSize - 1u);
+            }
+
+            /**
+             * Builds a file of {@param recordCount} records in the layout {@param T}'s meta describes. IDs are odd so that
+             * every other ID in range misses; WDB2 files carry an index block. Other fields hold noise or a few strings.
+             *
+             * {@param recordCount} must not exceed {@link GetSyntheticRecordLimit}, past which IDs no longer fit the index column.
+             */
+            template <typename T>
+            std::vector<uint8_t> MakeSyntheticFile(uint32_t recordCount)
+            {
+                using meta_t = typename Storage<T>::meta_t;
+                using header_type = typename Storage<T>::header_type;
+
+                std::vector<char> strings(1, '\0');
+                std::vector<uint32_t> stringOffsets;
+                for (uint32_t i = 0; i < 64; ++i)
+                {
+                    stringOffsets.push_back(uint32_t(strings.size()));
+
+                    std::string value = meta_t::name();
+                    value += " string ";
+                    value += std::to_string(i);
+                    strings.insert(strings.end(), value.c_str(), value.c_str() + value.size() + 1);
+                }
+
+                header_type header{ };
+                header.Magic = meta_t::sparse_storage ? '2BDW' : 'CBDW';
+                header.RecordCount = recordCount;
+                header.FieldCount = meta_t::field_count;
+                header.RecordSize = meta_t::record_size;
+                header.StringBlockSize = uint32_t(strings.size());
+
+                uint32_t maxID = recordCount * 2u - 1u;
+                if constexpr (meta_t::sparse_storage)
+                {
+                    if (recordCount != 0)
+                    {
+                        header.MinIndex = 1;
+                        header.MaxIndex = maxID;
+                    }
+                }
+
+                size_t recordOffset = Storage<T>::GetRecordOffset(header);
+                size_t stringTableOffset = recordOffset + size_t(recordCount) * meta_t::record_size;
+
+                std::vector<uint8_t> fileData(stringTableOffset + strings.size(), 0);
+                memcpy(fileData.data(), &header, sizeof(header_type));
+                memcpy(fileData.data() + stringTableOffset, strings.data(), strings.size());
+
+                if constexpr (meta_t::sparse_storage)
+                {
+                    // Rows of every ID in range, then string lengths, left at zero.
+                    for (uint32_t id = header.MinIndex; header.MaxIndex != 0 && id <= header.MaxIndex; ++id)
+                    {
+                        uint32_t row = (id & 1u) != 0 ? id / 2u : 0u;
+                        memcpy(fileData.data() + sizeof(header_type) + (id - header.MinIndex) * sizeof(uint32_t), &row, sizeof(uint32_t));
+                    }
+                }
+
+                std::mt19937 generator(recordCount);
+                for (uint32_t i = 0; i < recordCount; ++i)
+                {
+                    uint8_t* record = fileData.data() + recordOffset + size_t(i) * meta_t::record_size;
+                    for (uint32_t j = 0; j < meta_t::field_count; ++j)
+                    {
+                        uint8_t* field = record + meta_t::field_offsets[j];
+                        uint32_t fieldSize = meta_t::field_sizes[j];
+
+                        if (j == meta_t::index_column)
+                        {
+                            uint32_t id = i * 2u + 1u;
+                            memcpy(field, &id, std::min<uint32_t>(fieldSize, sizeof(uint32_t)));
+                        }
+                        else if (meta_t::field_types[j] == 's')
+                        {
+                            for (uint32_t k = 0; k < fieldSize / 4u; ++k)
+                                memcpy(field + 4u * k, &stringOffsets[(i + k) % stringOffsets.size()], sizeof(uint32_t));
+                        }
+                        else
+                        {
+                            for (uint32_t k = 0; k < fieldSize; ++k)
+                                field[k] = uint8_t(generator());
+                        }
+                    }
+                }
+
+                return fileData;
+            }
+
+            /**
+             * Loads every table from a synthetic file, replacing whatever was loaded, then times ID lookups and a
+             * full scan of it. Writes one JSON object per table.
+             */
+            struct SyntheticTableBenchmark
+            {
+                std::ostream& Output;
+                uint32_t RecordCount;
+
+                /// Lookups per measurement, at random IDs.
+                constexpr static const uint32_t LookupCount = 1u << 20;
+                /// Loads per table; the fastest one is reported.
+                constexpr static const uint32_t LoadCount = 3;
+
+                uint32_t TableCount = 0;
+                /// Tables given fewer records than asked for, because their index column is too narrow.
+                uint32_t ClampedCount = 0;
+                std::chrono::microseconds InitializeTotal{ 0 };
+
+                template <typename T>
+                void Visit()
+                {
+                    using meta_t = typename Storage<T>::meta_t;
+
+                    uint32_t recordCount = std::min(RecordCount, GetSyntheticRecordLimit<T>());
+                    bool clamped = recordCount != RecordCount;
+                    if (clamped)
+                        ++ClampedCount;
+
+                    std::vector<uint8_t> fileData = MakeSyntheticFile<T>(recordCount);
+
+                    size_t peakBefore = wowgm::utilities::GetPeakResidentSetSize();
+
+                    std::chrono::microseconds initialize = std::chrono::microseconds::max();
+                    for (uint32_t i = 0; i < LoadCount; ++i)
+                    {
+                        std::vector<uint8_t> copy = fileData;
+
+                        auto start = hrc::now();
+                        Storage<T>::LoadFromMemory(std::move(copy));
+                        initialize = std::min(initialize, std::chrono::duration_cast<std::chrono::microseconds>(hrc::now() - start));
+                    }
+
+                    size_t peakAfter = wowgm::utilities::GetPeakResidentSetSize();
+
+                    // Visit IDs out of order, as the game does.
+                    std::mt19937 generator(0x5EED);
+                    std::uniform_int_distribution<uint32_t> rows(0, recordCount - 1);
+
+                    std::vector<uint32_t> hits(LookupCount);
+                    for (uint32_t& id : hits)
+                        id = rows(generator) * 2u + 1u;
+
+                    volatile uint64_t sink = 0;
+                    auto measure = [](size_t operationCount, auto&& f) {
+                        auto start = hrc::now();
+                        f();
+                        return std::chrono::duration<double, std::nano>(hrc::now() - start).count() / std::max<size_t>(operationCount, 1u);
+                    };
+
+                    double hit = measure(hits.size(), [&]() {
+                        uint64_t found = 0;
+                        for (uint32_t id : hits)
+                            found += Storage<T>::GetRecord(id) != nullptr;
+                        sink = found;
+                    });
+
+                    // Even IDs fall inside the indexed range without matching a record.
+                    double miss = measure(hits.size(), [&]() {
+                        uint64_t found = 0;
+                        for (uint32_t id : hits)
+                            found += Storage<T>::GetRecord(id + 1u) != nullptr;
+                        sink = found;
+                    });
+
+                    RecordSpan<T> records = Storage<T>::GetRecords();
+                    double iterate = measure(records.size(), [&]() {
+                        uint64_t sum = 0;
+                        for (T const& record : records)
+                        {
+                            uint32_t id = 0;
+                            memcpy(&id, reinterpret_cast<uint8_t const*>(&record) + detail::decoded_field_offset<meta_t>(meta_t::index_column),
+                                std::min<uint32_t>(detail::decoded_field_size<meta_t>(meta_t::index_column), sizeof(uint32_t)));
+                            sum += id;
+                        }
+                        sink = sum;
+                    });
+
+                    InitializeTotal += initialize;
+
+                    // Table names are file names; nothing in them needs escaping.
+                    Output << (TableCount++ == 0 ? "\n" : ",\n")
+                        << "    { \"name\": \"" << meta_t::name() << "\""
+                        << ", \"format\": \"" << (meta_t::sparse_storage ? "WDB2" : "WDBC") << "\""
+                        << ", \"mapped\": " << (Storage<T>::is_mapped ? "true" : "false")
+                        << ", \"records\": " << Storage<T>::GetRecordCount()
+                        << ", \"records_clamped\": " << (clamped ? "true" : "false")
+                        << ", \"file_bytes\": " << fileData.size()
+                        << ", \"initialize_us\": " << initialize.count()
+                        << ", \"peak_rss_bytes\": " << peakAfter
+                        << ", \"peak_rss_growth_bytes\": " << (peakAfter - std::min(peakBefore, peakAfter))
+                        << ", \"lookup_hit_ns\": " << hit
+                        << ", \"lookup_miss_ns\": " << miss
+                        << ", \"iterate_ns_per_record\": " << iterate
+                        << " }";
+                }
+            };
+
+            /// Every table with a meta, in generation order.
+            template <typename Visitor>
+            void ForEachTable(Visitor& visitor)
+            {
+                visitor.template Visit<AchievementEntry>();
+                visitor.template Visit<Achievement_CategoryEntry>();
+                visitor.template Visit<Achievement_CriteriaEntry>();
+                visitor.template Visit<AnimKitBoneSetAliasEntry>();
+                visitor.template Visit<AnimKitBoneSetEntry>();
+                visitor.template Visit<AnimKitConfigBoneSetEntry>();
+                visitor.template Visit<AnimKitConfigEntry>();
+                visitor.template Visit<AnimKitEntry>();
+                visitor.template Visit<AnimKitPriorityEntry>();
+                visitor.template Visit<AnimKitSegmentEntry>();
+                visitor.template Visit<AnimReplacementEntry>();
+                visitor.template Visit<AnimReplacementSetEntry>();
+                visitor.template Visit<AnimationDataEntry>();
+                visitor.template Visit<AreaAssignmentEntry>();
+                visitor.template Visit<AreaGroupEntry>();
+                visitor.template Visit<AreaPOIEntry>();
+                visitor.template Visit<AreaPOISortedWorldStateEntry>();
+                visitor.template Visit<AreaTableEntry>();
+                visitor.template Visit<AreaTriggerEntry>();
+                visitor.template Visit<ArmorLocationEntry>();
+                visitor.template Visit<AuctionHouseEntry>();
+                visitor.template Visit<BankBagSlotPricesEntry>();
+                visitor.template Visit<BannedAddOnsEntry>();
+                visitor.template Visit<BarberShopStyleEntry>();
+                visitor.template Visit<BattlemasterListEntry>();
+                visitor.template Visit<CameraModeEntry>();
+                visitor.template Visit<CameraShakesEntry>();
+                visitor.template Visit<CastableRaidBuffsEntry>();
+                visitor.template Visit<Cfg_CategoriesEntry>();
+                visitor.template Visit<Cfg_ConfigsEntry>();
+                visitor.template Visit<CharBaseInfoEntry>();
+                visitor.template Visit<CharHairGeosetsEntry>();
+                visitor.template Visit<CharSectionsEntry>();
+                visitor.template Visit<CharStartOutfitEntry>();
+                visitor.template Visit<CharTitlesEntry>();
+                visitor.template Visit<CharacterFacialHairStylesEntry>();
+                visitor.template Visit<ChatChannelsEntry>();
+                visitor.template Visit<ChatProfanityEntry>();
+                visitor.template Visit<ChrClassesEntry>();
+                visitor.template Visit<ChrClassesXPowerTypesEntry>();
+                visitor.template Visit<ChrRacesEntry>();
+                visitor.template Visit<CinematicCameraEntry>();
+                visitor.template Visit<CinematicSequencesEntry>();
+                visitor.template Visit<CreatureDisplayInfoEntry>();
+                visitor.template Visit<CreatureDisplayInfoExtraEntry>();
+                visitor.template Visit<CreatureFamilyEntry>();
+                visitor.template Visit<CreatureImmunitiesEntry>();
+                visitor.template Visit<CreatureModelDataEntry>();
+                visitor.template Visit<CreatureMovementInfoEntry>();
+                visitor.template Visit<CreatureSoundDataEntry>();
+                visitor.template Visit<CreatureSpellDataEntry>();
+                visitor.template Visit<CreatureTypeEntry>();
+                visitor.template Visit<CurrencyCategoryEntry>();
+                visitor.template Visit<CurrencyTypesEntry>();
+                visitor.template Visit<DanceMovesEntry>();
+                visitor.template Visit<DeathThudLookupsEntry>();
+                visitor.template Visit<DeclinedWordCasesEntry>();
+                visitor.template Visit<DeclinedWordEntry>();
+                visitor.template Visit<DestructibleModelDataEntry>();
+                visitor.template Visit<DungeonEncounterEntry>();
+                visitor.template Visit<DungeonMapChunkEntry>();
+                visitor.template Visit<DungeonMapEntry>();
+                visitor.template Visit<DurabilityCostsEntry>();
+                visitor.template Visit<DurabilityQualityEntry>();
+                visitor.template Visit<EmotesEntry>();
+                visitor.template Visit<EmotesTextDataEntry>();
+                visitor.template Visit<EmotesTextEntry>();
+                visitor.template Visit<EmotesTextSoundEntry>();
+                visitor.template Visit<EnvironmentalDamageEntry>();
+                visitor.template Visit<ExhaustionEntry>();
+                visitor.template Visit<FactionEntry>();
+                visitor.template Visit<FactionGroupEntry>();
+                visitor.template Visit<FactionTemplateEntry>();
+                visitor.template Visit<FileDataEntry>();
+                visitor.template Visit<FootprintTexturesEntry>();
+                visitor.template Visit<FootstepTerrainLookupEntry>();
+                visitor.template Visit<GMSurveyAnswersEntry>();
+                visitor.template Visit<GMSurveyCurrentSurveyEntry>();
+                visitor.template Visit<GMSurveyQuestionsEntry>();
+                visitor.template Visit<GMSurveySurveysEntry>();
+                visitor.template Visit<GMTicketCategoryEntry>();
+                visitor.template Visit<GameObjectArtKitEntry>();
+                visitor.template Visit<GameObjectDisplayInfoEntry>();
+                visitor.template Visit<GameTablesEntry>();
+                visitor.template Visit<GameTipsEntry>();
+                visitor.template Visit<GemPropertiesEntry>();
+                visitor.template Visit<GlueScreenEmoteEntry>();
+                visitor.template Visit<GlyphPropertiesEntry>();
+                visitor.template Visit<GlyphSlotEntry>();
+                visitor.template Visit<GroundEffectDoodadEntry>();
+                visitor.template Visit<GroundEffectTextureEntry>();
+                visitor.template Visit<GuildColorBackgroundEntry>();
+                visitor.template Visit<GuildColorBorderEntry>();
+                visitor.template Visit<GuildColorEmblemEntry>();
+                visitor.template Visit<GuildPerkSpellsEntry>();
+                visitor.template Visit<HelmetGeosetVisDataEntry>();
+                visitor.template Visit<HolidayDescriptionsEntry>();
+                visitor.template Visit<HolidayNamesEntry>();
+                visitor.template Visit<HolidaysEntry>();
+                visitor.template Visit<ImportPriceArmorEntry>();
+                visitor.template Visit<ImportPriceQualityEntry>();
+                visitor.template Visit<ImportPriceShieldEntry>();
+                visitor.template Visit<ImportPriceWeaponEntry>();
+                visitor.template Visit<ItemArmorQualityEntry>();
+                visitor.template Visit<ItemArmorShieldEntry>();
+                visitor.template Visit<ItemArmorTotalEntry>();
+                visitor.template Visit<ItemBagFamilyEntry>();
+                visitor.template Visit<ItemClassEntry>();
+                visitor.template Visit<ItemCurrencyCostEntry>();
+                visitor.template Visit<ItemDamageAmmoEntry>();
+                visitor.template Visit<ItemDamageOneHandCasterEntry>();
+                visitor.template Visit<ItemDamageOneHandEntry>();
+                visitor.template Visit<ItemDamageRangedEntry>();
+                visitor.template Visit<ItemDamageThrownEntry>();
+                visitor.template Visit<ItemDamageTwoHandCasterEntry>();
+                visitor.template Visit<ItemDamageTwoHandEntry>();
+                visitor.template Visit<ItemDamageWandEntry>();
+                visitor.template Visit<ItemDisenchantLootEntry>();
+                visitor.template Visit<ItemDisplayInfoEntry>();
+                visitor.template Visit<ItemEntry>();
+                visitor.template Visit<ItemExtendedCostEntry>();
+                visitor.template Visit<ItemGroupSoundsEntry>();
+                visitor.template Visit<ItemLimitCategoryEntry>();
+                visitor.template Visit<ItemNameDescriptionEntry>();
+                visitor.template Visit<ItemPetFoodEntry>();
+                visitor.template Visit<ItemPriceBaseEntry>();
+                visitor.template Visit<ItemPurchaseGroupEntry>();
+                visitor.template Visit<ItemRandomPropertiesEntry>();
+                visitor.template Visit<ItemRandomSuffixEntry>();
+                visitor.template Visit<ItemReforgeEntry>();
+                visitor.template Visit<ItemSetEntry>();
+                visitor.template Visit<ItemSparseEntry>();
+                visitor.template Visit<ItemSubClassEntry>();
+                visitor.template Visit<ItemSubClassMaskEntry>();
+                visitor.template Visit<ItemVisualEffectsEntry>();
+                visitor.template Visit<ItemVisualsEntry>();
+                visitor.template Visit<JournalEncounterCreatureEntry>();
+                visitor.template Visit<JournalEncounterEntry>();
+                visitor.template Visit<JournalEncounterItemEntry>();
+                visitor.template Visit<JournalEncounterSectionEntry>();
+                visitor.template Visit<JournalInstanceEntry>();
+                visitor.template Visit<KeyChainEntry>();
+                visitor.template Visit<LanguageWordsEntry>();
+                visitor.template Visit<LanguagesEntry>();
+                visitor.template Visit<LfgDungeonExpansionEntry>();
+                visitor.template Visit<LfgDungeonGroupEntry>();
+                visitor.template Visit<LfgDungeonsEntry>();
+                visitor.template Visit<LfgDungeonsGroupingMapEntry>();
+                visitor.template Visit<LightEntry>();
+                visitor.template Visit<LightFloatBandEntry>();
+                visitor.template Visit<LightIntBandEntry>();
+                visitor.template Visit<LightParamsEntry>();
+                visitor.template Visit<LightSkyboxEntry>();
+                visitor.template Visit<LiquidMaterialEntry>();
+                visitor.template Visit<LiquidObjectEntry>();
+                visitor.template Visit<LiquidTypeEntry>();
+                visitor.template Visit<LoadingScreenTaxiSplinesEntry>();
+                visitor.template Visit<LoadingScreensEntry>();
+                visitor.template Visit<LockEntry>();
+                visitor.template Visit<LockTypeEntry>();
+                visitor.template Visit<MailTemplateEntry>();
+                visitor.template Visit<MapDifficultyEntry>();
+                visitor.template Visit<MapEntry>();
+                visitor.template Visit<MaterialEntry>();
+                visitor.template Visit<MountCapabilityEntry>();
+                visitor.template Visit<MountTypeEntry>();
+                visitor.template Visit<MovieEntry>();
+                visitor.template Visit<MovieFileDataEntry>();
+                visitor.template Visit<MovieVariationEntry>();
+                visitor.template Visit<NPCSoundsEntry>();
+                visitor.template Visit<NameGenEntry>();
+                visitor.template Visit<NamesProfanityEntry>();
+                visitor.template Visit<NamesReservedEntry>();
+                visitor.template Visit<NumTalentsAtLevelEntry>();
+                visitor.template Visit<ObjectEffectEntry>();
+                visitor.template Visit<ObjectEffectGroupEntry>();
+                visitor.template Visit<ObjectEffectModifierEntry>();
+                visitor.template Visit<ObjectEffectPackageElemEntry>();
+                visitor.template Visit<ObjectEffectPackageEntry>();
+                visitor.template Visit<OverrideSpellDataEntry>();
+                visitor.template Visit<PackageEntry>();
+                visitor.template Visit<PageTextMaterialEntry>();
+                visitor.template Visit<PaperDollItemFrameEntry>();
+                visitor.template Visit<ParticleColorEntry>();
+                visitor.template Visit<PhaseEntry>();
+                visitor.template Visit<PhaseShiftZoneSoundsEntry>();
+                visitor.template Visit<PhaseXPhaseGroupEntry>();
+                visitor.template Visit<PlayerConditionEntry>();
+                visitor.template Visit<PowerDisplayEntry>();
+                visitor.template Visit<PvpDifficultyEntry>();
+                visitor.template Visit<QuestFactionRewardEntry>();
+                visitor.template Visit<QuestInfoEntry>();
+                visitor.template Visit<QuestPOIBlobEntry>();
+                visitor.template Visit<QuestPOIPointEntry>();
+                visitor.template Visit<QuestSortEntry>();
+                visitor.template Visit<QuestXPEntry>();
+                visitor.template Visit<RandPropPointsEntry>();
+                visitor.template Visit<ResearchBranchEntry>();
+                visitor.template Visit<ResearchFieldEntry>();
+                visitor.template Visit<ResearchProjectEntry>();
+                visitor.template Visit<ResearchSiteEntry>();
+                visitor.template Visit<ResistancesEntry>();
+                visitor.template Visit<ScalingStatDistributionEntry>();
+                visitor.template Visit<ScalingStatValuesEntry>();
+                visitor.template Visit<ScreenEffectEntry>();
+                visitor.template Visit<ScreenLocationEntry>();
+                visitor.template Visit<ServerMessagesEntry>();
+                visitor.template Visit<SkillLineAbilityEntry>();
+                visitor.template Visit<SkillLineAbilitySortedSpellEntry>();
+                visitor.template Visit<SkillLineCategoryEntry>();
+                visitor.template Visit<SkillLineEntry>();
+                visitor.template Visit<SkillRaceClassInfoEntry>();
+                visitor.template Visit<SkillTiersEntry>();
+                visitor.template Visit<SoundAmbienceEntry>();
+                visitor.template Visit<SoundAmbienceFlavorEntry>();
+                visitor.template Visit<SoundEmitterPillPointsEntry>();
+                visitor.template Visit<SoundEmittersEntry>();
+                visitor.template Visit<SoundEntriesAdvancedEntry>();
+                visitor.template Visit<SoundEntriesEntry>();
+                visitor.template Visit<SoundEntriesFallbacksEntry>();
+                visitor.template Visit<SoundFilterElemEntry>();
+                visitor.template Visit<SoundFilterEntry>();
+                visitor.template Visit<SoundProviderPreferencesEntry>();
+                visitor.template Visit<SpamMessagesEntry>();
+                visitor.template Visit<SpellActivationOverlayEntry>();
+                visitor.template Visit<SpellAuraOptionsEntry>();
+                visitor.template Visit<SpellAuraRestrictionsEntry>();
+                visitor.template Visit<SpellAuraVisXTalentTabEntry>();
+                visitor.template Visit<SpellAuraVisibilityEntry>();
+                visitor.template Visit<SpellCastTimesEntry>();
+                visitor.template Visit<SpellCastingRequirementsEntry>();
+                visitor.template Visit<SpellCategoriesEntry>();
+                visitor.template Visit<SpellCategoryEntry>();
+                visitor.template Visit<SpellChainEffectsEntry>();
+                visitor.template Visit<SpellClassOptionsEntry>();
+                visitor.template Visit<SpellCooldownsEntry>();
+                visitor.template Visit<SpellDescriptionVariablesEntry>();
+                visitor.template Visit<SpellDifficultyEntry>();
+                visitor.template Visit<SpellDispelTypeEntry>();
+                visitor.template Visit<SpellDurationEntry>();
+                visitor.template Visit<SpellEffectCameraShakesEntry>();
+                visitor.template Visit<SpellEffectEntry>();
+                visitor.template Visit<SpellEntry>();
+                visitor.template Visit<SpellEquippedItemsEntry>();
+                visitor.template Visit<SpellFlyoutEntry>();
+                visitor.template Visit<SpellFlyoutItemEntry>();
+                visitor.template Visit<SpellFocusObjectEntry>();
+                visitor.template Visit<SpellIconEntry>();
+                visitor.template Visit<SpellInterruptsEntry>();
+                visitor.template Visit<SpellItemEnchantmentConditionEntry>();
+                visitor.template Visit<SpellItemEnchantmentEntry>();
+                visitor.template Visit<SpellLevelsEntry>();
+                visitor.template Visit<SpellMechanicEntry>();
+                visitor.template Visit<SpellMissileEntry>();
+                visitor.template Visit<SpellMissileMotionEntry>();
+                visitor.template Visit<SpellPowerEntry>();
+                visitor.template Visit<SpellRadiusEntry>();
+                visitor.template Visit<SpellRangeEntry>();
+                visitor.template Visit<SpellReagentsEntry>();
+                visitor.template Visit<SpellRuneCostEntry>();
+                visitor.template Visit<SpellScalingEntry>();
+                visitor.template Visit<SpellShapeshiftEntry>();
+                visitor.template Visit<SpellShapeshiftFormEntry>();
+                visitor.template Visit<SpellSpecialUnitEffectEntry>();
+                visitor.template Visit<SpellTargetRestrictionsEntry>();
+                visitor.template Visit<SpellTotemsEntry>();
+                visitor.template Visit<SpellVisualEffectNameEntry>();
+                visitor.template Visit<SpellVisualEntry>();
+                visitor.template Visit<SpellVisualKitAreaModelEntry>();
+                visitor.template Visit<SpellVisualKitEntry>();
+                visitor.template Visit<SpellVisualKitModelAttachEntry>();
+                visitor.template Visit<Startup_StringsEntry>();
+                visitor.template Visit<StationeryEntry>();
+                visitor.template Visit<StringLookupsEntry>();
+                visitor.template Visit<SummonPropertiesEntry>();
+                visitor.template Visit<TalentEntry>();
+                visitor.template Visit<TalentTabEntry>();
+                visitor.template Visit<TalentTreePrimarySpellsEntry>();
+                visitor.template Visit<TaxiNodesEntry>();
+                visitor.template Visit<TaxiPathEntry>();
+                visitor.template Visit<TaxiPathNodeEntry>();
+                visitor.template Visit<TerrainMaterialEntry>();
+                visitor.template Visit<TerrainTypeEntry>();
+                visitor.template Visit<TerrainTypeSoundsEntry>();
+                visitor.template Visit<TotemCategoryEntry>();
+                visitor.template Visit<TransportAnimationEntry>();
+                visitor.template Visit<TransportPhysicsEntry>();
+                visitor.template Visit<TransportRotationEntry>();
+                visitor.template Visit<UnitBloodEntry>();
+                visitor.template Visit<UnitBloodLevelsEntry>();
+                visitor.template Visit<UnitPowerBarEntry>();
+                visitor.template Visit<VehicleEntry>();
+                visitor.template Visit<VehicleSeatEntry>();
+                visitor.template Visit<VehicleUIIndSeatEntry>();
+                visitor.template Visit<VehicleUIIndicatorEntry>();
+                visitor.template Visit<VideoHardwareEntry>();
+                visitor.template Visit<VocalUISoundsEntry>();
+                visitor.template Visit<WMOAreaTableEntry>();
+                visitor.template Visit<WeaponImpactSoundsEntry>();
+                visitor.template Visit<WeaponSwingSounds2Entry>();
+                visitor.template Visit<WeatherEntry>();
+                visitor.template Visit<WorldChunkSoundsEntry>();
+                visitor.template Visit<WorldMapAreaEntry>();
+                visitor.template Visit<WorldMapContinentEntry>();
+                visitor.template Visit<WorldMapOverlayEntry>();
+                visitor.template Visit<WorldMapTransformsEntry>();
+                visitor.template Visit<WorldSafeLocsEntry>();
+                visitor.template Visit<WorldStateUIEntry>();
+                visitor.template Visit<WorldStateZoneSoundsEntry>();
+                visitor.template Visit<World_PVP_AreaEntry>();
+                visitor.template Visit<ZoneIntroMusicTableEntry>();
+                visitor.template Visit<ZoneLightEntry>();
+                visitor.template Visit<ZoneLightPointEntry>();
+                visitor.template Visit<ZoneMusicEntry>();
+                visitor.template Visit<gtBarberShopCostBaseEntry>();
+                visitor.template Visit<gtChanceToMeleeCritBaseEntry>();
+                visitor.template Visit<gtChanceToMeleeCritEntry>();
+                visitor.template Visit<gtChanceToSpellCritBaseEntry>();
+                visitor.template Visit<gtChanceToSpellCritEntry>();
+                visitor.template Visit<gtCombatRatingsEntry>();
+                visitor.template Visit<gtNPCManaCostScalerEntry>();
+                visitor.template Visit<gtOCTBaseHPByClassEntry>();
+                visitor.template Visit<gtOCTBaseMPByClassEntry>();
+                visitor.template Visit<gtOCTClassCombatRatingScalarEntry>();
+                visitor.template Visit<gtOCTHpPerStaminaEntry>();
+                visitor.template Visit<gtOCTRegenMPEntry>();
+                visitor.template Visit<gtRegenMPPerSptEntry>();
+                visitor.template Visit<gtSpellScalingEntry>();
+            }
+
+            /**
+             * Tables known to be needed by every session. Anything else loads on first access through
+             * {@link Storage<T>::GetRecord}, so entries only need uncommenting to be warmed up ahead of time.
+             */
+            void QueuePrefetchList(TableLoader& loader)
+            {
+                // loader.Load<Startup_StringsEntry>();
+                loader.Load<ItemSparseEntry>();
+                loader.Load<ItemEntry>();
+                // loader.Load<SpellVisualKitEntry>();
+                // loader.Load<SpellVisualEffectNameEntry>();
+                // loader.Load<SpellEffectEntry>();
+                // loader.Load<ParticleColorEntry>();
+                // loader.Load<ObjectEffectPackageElemEntry>();
+                // loader.Load<ObjectEffectPackageEntry>();
+                // loader.Load<ObjectEffectModifierEntry>();
+                // loader.Load<ObjectEffectGroupEntry>();
+                // loader.Load<ObjectEffectEntry>();
+                // loader.Load<NameGenEntry>();
+                // loader.Load<LoadingScreensEntry>();
+                // loader.Load<ItemVisualEffectsEntry>();
+                // loader.Load<ItemVisualsEntry>();
+                // loader.Load<ItemDisplayInfoEntry>();
+                // loader.Load<HelmetGeosetVisDataEntry>();
+                // loader.Load<GuildColorEmblemEntry>();
+                // loader.Load<GuildColorBorderEntry>();
+                // loader.Load<GuildColorBackgroundEntry>();
+                // loader.Load<GlueScreenEmoteEntry>();
+                // loader.Load<GameTipsEntry>();
+                // loader.Load<CreatureModelDataEntry>();
+                // loader.Load<CreatureFamilyEntry>();
+                // loader.Load<CreatureDisplayInfoExtraEntry>();
+                // loader.Load<CreatureDisplayInfoEntry>();
+                // loader.Load<CharStartOutfitEntry>();
+                // loader.Load<AnimReplacementSetEntry>();
+                // loader.Load<AnimReplacementEntry>();
+                // loader.Load<AnimKitSegmentEntry>();
+                // loader.Load<AnimKitPriorityEntry>();
+                // loader.Load<SoundProviderPreferencesEntry>();
+                // loader.Load<SpamMessagesEntry>();
+                // loader.Load<SoundFilterElemEntry>();
+                // loader.Load<SoundFilterEntry>();
+                // loader.Load<ResistancesEntry>();
+                // loader.Load<NamesReservedEntry>();
+                // loader.Load<NamesProfanityEntry>();
+                // loader.Load<MovieVariationEntry>();
+                // loader.Load<MovieFileDataEntry>();
+                // loader.Load<MovieEntry>();
+                // loader.Load<ItemSubClassEntry>();
+                // loader.Load<ItemClassEntry>();
+                // loader.Load<FileDataEntry>();
+                // loader.Load<FactionTemplateEntry>();
+                // loader.Load<FactionGroupEntry>();
+                loader.Load<ChrRacesEntry>();
+                loader.Load<ChrClassesEntry>();
+                // loader.Load<ChatProfanityEntry>();
+                // loader.Load<CharacterFacialHairStylesEntry>();
+                // loader.Load<CharSectionsEntry>();
+                // loader.Load<CharHairGeosetsEntry>();
+                // loader.Load<CharBaseInfoEntry>();
+                // loader.Load<Cfg_ConfigsEntry>();
+                // loader.Load<Cfg_CategoriesEntry>();
+                // loader.Load<BannedAddOnsEntry>();
+                // loader.Load<AnimKitConfigBoneSetEntry>();
+                // loader.Load<AnimKitConfigEntry>();
+                // loader.Load<AnimKitEntry>();
+                // loader.Load<AnimKitBoneSetEntry>();
+                // loader.Load<AnimKitBoneSetAliasEntry>();
+                // loader.Load<PhaseShiftZoneSoundsEntry>();
+                // loader.Load<WorldChunkSoundsEntry>();
+                // loader.Load<WorldStateZoneSoundsEntry>();
+                // loader.Load<ZoneMusicEntry>();
+                // loader.Load<ZoneIntroMusicTableEntry>();
+                // loader.Load<WorldStateUIEntry>();
+                // loader.Load<WorldSafeLocsEntry>();
+                // loader.Load<WorldMapTransformsEntry>();
+                // loader.Load<WorldMapOverlayEntry>();
+                // loader.Load<WorldMapContinentEntry>();
+                // loader.Load<WorldMapAreaEntry>();
+                // loader.Load<WeaponSwingSounds2Entry>();
+                // loader.Load<WeaponImpactSoundsEntry>();
+                // loader.Load<World_PVP_AreaEntry>();
+                // loader.Load<VocalUISoundsEntry>();
+                // loader.Load<VehicleUIIndSeatEntry>();
+                // loader.Load<VehicleUIIndicatorEntry>();
+                // loader.Load<VehicleSeatEntry>();
+                // loader.Load<VehicleEntry>();
+                // loader.Load<UnitPowerBarEntry>();
+                // loader.Load<UnitBloodEntry>();
+                // loader.Load<UnitBloodLevelsEntry>();
+                // loader.Load<TransportRotationEntry>();
+                // loader.Load<TransportPhysicsEntry>();
+                // loader.Load<TransportAnimationEntry>();
+                // loader.Load<TotemCategoryEntry>();
+                // loader.Load<TerrainTypeSoundsEntry>();
+                // loader.Load<TaxiPathEntry>();
+                // loader.Load<TaxiPathNodeEntry>();
+                // loader.Load<TaxiNodesEntry>();
+                // loader.Load<TalentTreePrimarySpellsEntry>();
+                // loader.Load<TalentTabEntry>();
+                // loader.Load<TalentEntry>();
+                // loader.Load<SummonPropertiesEntry>();
+                // loader.Load<StringLookupsEntry>();
+                // loader.Load<StationeryEntry>();
+                // loader.Load<SpellVisualKitModelAttachEntry>();
+                // loader.Load<SpellVisualKitAreaModelEntry>();
+                // loader.Load<SpellVisualEntry>();
+                // loader.Load<SpellTotemsEntry>();
+                // loader.Load<SpellTargetRestrictionsEntry>();
+                // loader.Load<SpellSpecialUnitEffectEntry>();
+                // loader.Load<SpellShapeshiftFormEntry>();
+                // loader.Load<SpellShapeshiftEntry>();
+                // loader.Load<SpellScalingEntry>();
+                // loader.Load<SpellRuneCostEntry>();
+                // loader.Load<SpellReagentsEntry>();
+                // loader.Load<SpellPowerEntry>();
+                // loader.Load<SpellRangeEntry>();
+                // loader.Load<SpellRadiusEntry>();
+                // loader.Load<SpellMissileMotionEntry>();
+                // loader.Load<SpellMissileEntry>();
+                // loader.Load<SpellMechanicEntry>();
+                // loader.Load<SpellLevelsEntry>();
+                // loader.Load<SpellItemEnchantmentConditionEntry>();
+                // loader.Load<SpellItemEnchantmentEntry>();
+                // loader.Load<SpellInterruptsEntry>();
+                // loader.Load<SpellIconEntry>();
+                // loader.Load<SpellFocusObjectEntry>();
+                // loader.Load<SpellFlyoutItemEntry>();
+                // loader.Load<SpellFlyoutEntry>();
+                // loader.Load<SpellEquippedItemsEntry>();
+                // loader.Load<SpellEffectCameraShakesEntry>();
+                // loader.Load<SpellDurationEntry>();
+                // loader.Load<SpellDispelTypeEntry>();
+                // loader.Load<SpellDifficultyEntry>();
+                // loader.Load<SpellDescriptionVariablesEntry>();
+                loader.Load<SpellEntry>();
+                // loader.Load<SpellCooldownsEntry>();
+                // loader.Load<SpellClassOptionsEntry>();
+                // loader.Load<SpellChainEffectsEntry>();
+                // loader.Load<SpellCategoryEntry>();
+                // loader.Load<SpellCategoriesEntry>();
+                // loader.Load<SpellCastTimesEntry>();
+                // loader.Load<SpellCastingRequirementsEntry>();
+                // loader.Load<SpellAuraVisXTalentTabEntry>();
+                // loader.Load<SpellAuraVisibilityEntry>();
+                // loader.Load<SpellAuraRestrictionsEntry>();
+                // loader.Load<SpellAuraOptionsEntry>();
+                // loader.Load<SpellActivationOverlayEntry>();
+                // loader.Load<SoundAmbienceFlavorEntry>();
+                // loader.Load<SoundAmbienceEntry>();
+                // loader.Load<SkillTiersEntry>();
+                // loader.Load<SkillRaceClassInfoEntry>();
+                // loader.Load<SkillLineEntry>();
+                // loader.Load<SkillLineCategoryEntry>();
+                // loader.Load<SkillLineAbilitySortedSpellEntry>();
+                // loader.Load<SkillLineAbilityEntry>();
+                // loader.Load<ServerMessagesEntry>();
+                // loader.Load<ScreenLocationEntry>();
+                // loader.Load<ScreenEffectEntry>();
+                // loader.Load<ScalingStatValuesEntry>();
+                // loader.Load<ScalingStatDistributionEntry>();
+                // loader.Load<RandPropPointsEntry>();
+                // loader.Load<ResearchSiteEntry>();
+                // loader.Load<ResearchProjectEntry>();
+                // loader.Load<ResearchFieldEntry>();
+                // loader.Load<ResearchBranchEntry>();
+                // loader.Load<QuestXPEntry>();
+                // loader.Load<QuestSortEntry>();
+                // loader.Load<QuestPOIPointEntry>();
+                // loader.Load<QuestPOIBlobEntry>();
+                // loader.Load<QuestInfoEntry>();
+                // loader.Load<QuestFactionRewardEntry>();
+                // loader.Load<PvpDifficultyEntry>();
+                // loader.Load<PowerDisplayEntry>();
+                // loader.Load<PlayerConditionEntry>();
+                // loader.Load<PhaseXPhaseGroupEntry>();
+                // loader.Load<PhaseEntry>();
+                // loader.Load<PaperDollItemFrameEntry>();
+                // loader.Load<PageTextMaterialEntry>();
+                // loader.Load<PackageEntry>();
+                // loader.Load<OverrideSpellDataEntry>();
+                // loader.Load<NumTalentsAtLevelEntry>();
+                // loader.Load<NPCSoundsEntry>();
+                // loader.Load<MountTypeEntry>();
+                // loader.Load<MountCapabilityEntry>();
+                // loader.Load<MaterialEntry>();
+                // loader.Load<MapDifficultyEntry>();
+                // loader.Load<MailTemplateEntry>();
+                // loader.Load<LockTypeEntry>();
+                // loader.Load<LockEntry>();
+                // loader.Load<LoadingScreenTaxiSplinesEntry>();
+                // loader.Load<LfgDungeonsEntry>();
+                // loader.Load<LfgDungeonsGroupingMapEntry>();
+                // loader.Load<LfgDungeonGroupEntry>();
+                // loader.Load<LfgDungeonExpansionEntry>();
+                // loader.Load<LanguagesEntry>();
+                // loader.Load<LanguageWordsEntry>();
+                // loader.Load<JournalInstanceEntry>();
+                // loader.Load<JournalEncounterSectionEntry>();
+                // loader.Load<JournalEncounterEntry>();
+                // loader.Load<JournalEncounterItemEntry>();
+                // loader.Load<JournalEncounterCreatureEntry>();
+                // loader.Load<ItemSubClassMaskEntry>();
+                // loader.Load<ItemSetEntry>();
+                // loader.Load<ItemReforgeEntry>();
+                // loader.Load<ItemRandomSuffixEntry>();
+                // loader.Load<ItemRandomPropertiesEntry>();
+                // loader.Load<ItemPurchaseGroupEntry>();
+                // loader.Load<ItemPriceBaseEntry>();
+                // loader.Load<ItemPetFoodEntry>();
+                // loader.Load<ItemNameDescriptionEntry>();
+                // loader.Load<ItemLimitCategoryEntry>();
+                // loader.Load<ItemGroupSoundsEntry>();
+                // loader.Load<ItemDisenchantLootEntry>();
+                // loader.Load<ItemDamageWandEntry>();
+                // loader.Load<ItemDamageTwoHandCasterEntry>();
+                // loader.Load<ItemDamageTwoHandEntry>();
+                // loader.Load<ItemDamageThrownEntry>();
+                // loader.Load<ItemDamageRangedEntry>();
+                // loader.Load<ItemDamageOneHandCasterEntry>();
+                // loader.Load<ItemDamageOneHandEntry>();
+                // loader.Load<ItemDamageAmmoEntry>();
+                // loader.Load<ItemBagFamilyEntry>();
+                // loader.Load<ItemArmorShieldEntry>();
+                // loader.Load<ItemArmorTotalEntry>();
+                // loader.Load<ItemArmorQualityEntry>();
+                // loader.Load<ImportPriceWeaponEntry>();
+                // loader.Load<ImportPriceShieldEntry>();
+                // loader.Load<ImportPriceQualityEntry>();
+                // loader.Load<ImportPriceArmorEntry>();
+                // loader.Load<HolidaysEntry>();
+                // loader.Load<HolidayNamesEntry>();
+                // loader.Load<HolidayDescriptionsEntry>();
+                // loader.Load<GuildPerkSpellsEntry>();
+                // loader.Load<gtSpellScalingEntry>();
+                // loader.Load<gtRegenMPPerSptEntry>();
+                // loader.Load<gtOCTRegenMPEntry>();
+                // loader.Load<gtOCTHpPerStaminaEntry>();
+                // loader.Load<gtOCTClassCombatRatingScalarEntry>();
+                // loader.Load<gtOCTBaseMPByClassEntry>();
+                // loader.Load<gtOCTBaseHPByClassEntry>();
+                // loader.Load<gtNPCManaCostScalerEntry>();
+                // loader.Load<gtChanceToSpellCritBaseEntry>();
+                // loader.Load<gtChanceToSpellCritEntry>();
+                // loader.Load<gtChanceToMeleeCritBaseEntry>();
+                // loader.Load<gtChanceToMeleeCritEntry>();
+                // loader.Load<gtCombatRatingsEntry>();
+                // loader.Load<gtBarberShopCostBaseEntry>();
+                // loader.Load<GMTicketCategoryEntry>();
+                // loader.Load<GMSurveySurveysEntry>();
+                // loader.Load<GMSurveyQuestionsEntry>();
+                // loader.Load<GMSurveyCurrentSurveyEntry>();
+                // loader.Load<GMSurveyAnswersEntry>();
+                // loader.Load<GlyphSlotEntry>();
+                // loader.Load<GlyphPropertiesEntry>();
+                // loader.Load<GemPropertiesEntry>();
+                // loader.Load<GameTablesEntry>();
+                // loader.Load<GameObjectDisplayInfoEntry>();
+                // loader.Load<GameObjectArtKitEntry>();
+                // loader.Load<FootstepTerrainLookupEntry>();
+                // loader.Load<FactionEntry>();
+                // loader.Load<ExhaustionEntry>();
+                // loader.Load<EnvironmentalDamageEntry>();
+                // loader.Load<EmotesTextEntry>();
+                // loader.Load<EmotesTextSoundEntry>();
+                // loader.Load<EmotesTextDataEntry>();
+                // loader.Load<EmotesEntry>();
+                // loader.Load<DurabilityQualityEntry>();
+                // loader.Load<DurabilityCostsEntry>();
+                // loader.Load<DungeonMapChunkEntry>();
+                // loader.Load<DungeonMapEntry>();
+                // loader.Load<DungeonEncounterEntry>();
+                // loader.Load<DestructibleModelDataEntry>();
+                // loader.Load<DeathThudLookupsEntry>();
+                // loader.Load<DanceMovesEntry>();
+                // loader.Load<CurrencyCategoryEntry>();
+                // loader.Load<CurrencyTypesEntry>();
+                // loader.Load<CreatureTypeEntry>();
+                // loader.Load<CreatureSpellDataEntry>();
+                // loader.Load<CreatureSoundDataEntry>();
+                // loader.Load<CreatureMovementInfoEntry>();
+                // loader.Load<CreatureImmunitiesEntry>();
+                // loader.Load<CinematicSequencesEntry>();
+                // loader.Load<CinematicCameraEntry>();
+                // loader.Load<ChrClassesXPowerTypesEntry>();
+                // loader.Load<ChatChannelsEntry>();
+                // loader.Load<CharTitlesEntry>();
+                // loader.Load<CastableRaidBuffsEntry>();
+                // loader.Load<CameraShakesEntry>();
+                // loader.Load<CameraModeEntry>();
+                // loader.Load<BattlemasterListEntry>();
+                // loader.Load<BarberShopStyleEntry>();
+                // loader.Load<BankBagSlotPricesEntry>();
+                // loader.Load<AuctionHouseEntry>();
+                // loader.Load<ArmorLocationEntry>();
+                // loader.Load<AreaTriggerEntry>();
+                // loader.Load<AreaAssignmentEntry>();
+                // loader.Load<AreaPOISortedWorldStateEntry>();
+                // loader.Load<AreaPOIEntry>();
+                // loader.Load<AreaGroupEntry>();
+                // loader.Load<Achievement_CategoryEntry>();
+                // loader.Load<Achievement_CriteriaEntry>();
+                // loader.Load<AchievementEntry>();
+                // loader.Load<ItemCurrencyCostEntry>();
+                // loader.Load<ItemExtendedCostEntry>();
+                // loader.Load<KeyChainEntry>();
+                // loader.Load<DeclinedWordCasesEntry>();
+                // loader.Load<DeclinedWordEntry>();
+                // loader.Load<ZoneLightPointEntry>();
+                // loader.Load<ZoneLightEntry>();
+                // loader.Load<WMOAreaTableEntry>();
+                // loader.Load<WeatherEntry>();
+                // loader.Load<TerrainTypeEntry>();
+                // loader.Load<TerrainMaterialEntry>();
+                // loader.Load<SoundEntriesFallbacksEntry>();
+                // loader.Load<SoundEmittersEntry>();
+                // loader.Load<SoundEmitterPillPointsEntry>();
+                // loader.Load<LiquidTypeEntry>();
+                // loader.Load<LiquidObjectEntry>();
+                // loader.Load<LiquidMaterialEntry>();
+                // loader.Load<LightSkyboxEntry>();
+                // loader.Load<LightFloatBandEntry>();
+                // loader.Load<LightEntry>();
+                // loader.Load<GroundEffectTextureEntry>();
+                // loader.Load<GroundEffectDoodadEntry>();
+                // loader.Load<FootprintTexturesEntry>();
+                loader.Load<MapEntry>();
+            }
+        }
+
+        void Initialize()
+        {
             auto start = hrc::now();
 
-            // Storage<Startup_StringsEntry>::Initialize();
-            Storage<ItemSparseEntry>::Initialize();
-            // Storage<ItemEntry>::Initialize();
-            // Storage<SpellVisualKitEntry>::Initialize();
-            // Storage<SpellVisualEffectNameEntry>::Initialize();
-            // Storage<SpellEffectEntry>::Initialize();
-            // Storage<ParticleColorEntry>::Initialize();
-            // Storage<ObjectEffectPackageElemEntry>::Initialize();
-            // Storage<ObjectEffectPackageEntry>::Initialize();
-            // Storage<ObjectEffectModifierEntry>::Initialize();
-            // Storage<ObjectEffectGroupEntry>::Initialize();
-            // Storage<ObjectEffectEntry>::Initialize();
-            // Storage<NameGenEntry>::Initialize();
-            // Storage<LoadingScreensEntry>::Initialize();
-            // Storage<ItemVisualEffectsEntry>::Initialize();
-            // Storage<ItemVisualsEntry>::Initialize();
-            // Storage<ItemDisplayInfoEntry>::Initialize();
-            // Storage<HelmetGeosetVisDataEntry>::Initialize();
-            // Storage<GuildColorEmblemEntry>::Initialize();
-            // Storage<GuildColorBorderEntry>::Initialize();
-            // Storage<GuildColorBackgroundEntry>::Initialize();
-            // Storage<GlueScreenEmoteEntry>::Initialize();
-            // Storage<GameTipsEntry>::Initialize();
-            // Storage<CreatureModelDataEntry>::Initialize();
-            // Storage<CreatureFamilyEntry>::Initialize();
-            // Storage<CreatureDisplayInfoExtraEntry>::Initialize();
-            // Storage<CreatureDisplayInfoEntry>::Initialize();
-            // Storage<CharStartOutfitEntry>::Initialize();
-            // Storage<AnimReplacementSetEntry>::Initialize();
-            // Storage<AnimReplacementEntry>::Initialize();
-            // Storage<AnimKitSegmentEntry>::Initialize();
-            // Storage<AnimKitPriorityEntry>::Initialize();
-            // Storage<SoundProviderPreferencesEntry>::Initialize();
-            // Storage<SpamMessagesEntry>::Initialize();
-            // Storage<SoundFilterElemEntry>::Initialize();
-            // Storage<SoundFilterEntry>::Initialize();
-            // Storage<ResistancesEntry>::Initialize();
-            // Storage<NamesReservedEntry>::Initialize();
-            // Storage<NamesProfanityEntry>::Initialize();
-            // Storage<MovieVariationEntry>::Initialize();
-            // Storage<MovieFileDataEntry>::Initialize();
-            // Storage<MovieEntry>::Initialize();
-            // Storage<ItemSubClassEntry>::Initialize();
-            // Storage<ItemClassEntry>::Initialize();
-            // Storage<FileDataEntry>::Initialize();
-            // Storage<FactionTemplateEntry>::Initialize();
-            // Storage<FactionGroupEntry>::Initialize();
-            Storage<ChrRacesEntry>::Initialize();
-            Storage<ChrClassesEntry>::Initialize();
-            // Storage<ChatProfanityEntry>::Initialize();
-            // Storage<CharacterFacialHairStylesEntry>::Initialize();
-            // Storage<CharSectionsEntry>::Initialize();
-            // Storage<CharHairGeosetsEntry>::Initialize();
-            // Storage<CharBaseInfoEntry>::Initialize();
-            // Storage<Cfg_ConfigsEntry>::Initialize();
-            // Storage<Cfg_CategoriesEntry>::Initialize();
-            // Storage<BannedAddOnsEntry>::Initialize();
-            // Storage<AnimKitConfigBoneSetEntry>::Initialize();
-            // Storage<AnimKitConfigEntry>::Initialize();
-            // Storage<AnimKitEntry>::Initialize();
-            // Storage<AnimKitBoneSetEntry>::Initialize();
-            // Storage<AnimKitBoneSetAliasEntry>::Initialize();
-            // Storage<PhaseShiftZoneSoundsEntry>::Initialize();
-            // Storage<WorldChunkSoundsEntry>::Initialize();
-            // Storage<WorldStateZoneSoundsEntry>::Initialize();
-            // Storage<ZoneMusicEntry>::Initialize();
-            // Storage<ZoneIntroMusicTableEntry>::Initialize();
-            // Storage<WorldStateUIEntry>::Initialize();
-            // Storage<WorldSafeLocsEntry>::Initialize();
-            // Storage<WorldMapTransformsEntry>::Initialize();
-            // Storage<WorldMapOverlayEntry>::Initialize();
-            // Storage<WorldMapContinentEntry>::Initialize();
-            // Storage<WorldMapAreaEntry>::Initialize();
-            // Storage<WeaponSwingSounds2Entry>::Initialize();
-            // Storage<WeaponImpactSoundsEntry>::Initialize();
-            // Storage<World_PVP_AreaEntry>::Initialize();
-            // Storage<VocalUISoundsEntry>::Initialize();
-            // Storage<VehicleUIIndSeatEntry>::Initialize();
-            // Storage<VehicleUIIndicatorEntry>::Initialize();
-            // Storage<VehicleSeatEntry>::Initialize();
-            // Storage<VehicleEntry>::Initialize();
-            // Storage<UnitPowerBarEntry>::Initialize();
-            // Storage<UnitBloodEntry>::Initialize();
-            // Storage<UnitBloodLevelsEntry>::Initialize();
-            // Storage<TransportRotationEntry>::Initialize();
-            // Storage<TransportPhysicsEntry>::Initialize();
-            // Storage<TransportAnimationEntry>::Initialize();
-            // Storage<TotemCategoryEntry>::Initialize();
-            // Storage<TerrainTypeSoundsEntry>::Initialize();
-            // Storage<TaxiPathEntry>::Initialize();
-            // Storage<TaxiPathNodeEntry>::Initialize();
-            // Storage<TaxiNodesEntry>::Initialize();
-            // Storage<TalentTreePrimarySpellsEntry>::Initialize();
-            // Storage<TalentTabEntry>::Initialize();
-            // Storage<TalentEntry>::Initialize();
-            // Storage<SummonPropertiesEntry>::Initialize();
-            // Storage<StringLookupsEntry>::Initialize();
-            // Storage<StationeryEntry>::Initialize();
-            // Storage<SpellVisualKitModelAttachEntry>::Initialize();
-            // Storage<SpellVisualKitAreaModelEntry>::Initialize();
-            // Storage<SpellVisualEntry>::Initialize();
-            // Storage<SpellTotemsEntry>::Initialize();
-            // Storage<SpellTargetRestrictionsEntry>::Initialize();
-            // Storage<SpellSpecialUnitEffectEntry>::Initialize();
-            // Storage<SpellShapeshiftFormEntry>::Initialize();
-            // Storage<SpellShapeshiftEntry>::Initialize();
-            // Storage<SpellScalingEntry>::Initialize();
-            // Storage<SpellRuneCostEntry>::Initialize();
-            // Storage<SpellReagentsEntry>::Initialize();
-            // Storage<SpellPowerEntry>::Initialize();
-            // Storage<SpellRangeEntry>::Initialize();
-            // Storage<SpellRadiusEntry>::Initialize();
-            // Storage<SpellMissileMotionEntry>::Initialize();
-            // Storage<SpellMissileEntry>::Initialize();
-            // Storage<SpellMechanicEntry>::Initialize();
-            // Storage<SpellLevelsEntry>::Initialize();
-            // Storage<SpellItemEnchantmentConditionEntry>::Initialize();
-            // Storage<SpellItemEnchantmentEntry>::Initialize();
-            // Storage<SpellInterruptsEntry>::Initialize();
-            // Storage<SpellIconEntry>::Initialize();
-            // Storage<SpellFocusObjectEntry>::Initialize();
-            // Storage<SpellFlyoutItemEntry>::Initialize();
-            // Storage<SpellFlyoutEntry>::Initialize();
-            // Storage<SpellEquippedItemsEntry>::Initialize();
-            // Storage<SpellEffectCameraShakesEntry>::Initialize();
-            // Storage<SpellDurationEntry>::Initialize();
-            // Storage<SpellDispelTypeEntry>::Initialize();
-            // Storage<SpellDifficultyEntry>::Initialize();
-            // Storage<SpellDescriptionVariablesEntry>::Initialize();
-            Storage<SpellEntry>::Initialize();
-            // Storage<SpellCooldownsEntry>::Initialize();
-            // Storage<SpellClassOptionsEntry>::Initialize();
-            // Storage<SpellChainEffectsEntry>::Initialize();
-            // Storage<SpellCategoryEntry>::Initialize();
-            // Storage<SpellCategoriesEntry>::Initialize();
-            // Storage<SpellCastTimesEntry>::Initialize();
-            // Storage<SpellCastingRequirementsEntry>::Initialize();
-            // Storage<SpellAuraVisXTalentTabEntry>::Initialize();
-            // Storage<SpellAuraVisibilityEntry>::Initialize();
-            // Storage<SpellAuraRestrictionsEntry>::Initialize();
-            // Storage<SpellAuraOptionsEntry>::Initialize();
-            // Storage<SpellActivationOverlayEntry>::Initialize();
-            // Storage<SoundAmbienceFlavorEntry>::Initialize();
-            // Storage<SoundAmbienceEntry>::Initialize();
-            // Storage<SkillTiersEntry>::Initialize();
-            // Storage<SkillRaceClassInfoEntry>::Initialize();
-            // Storage<SkillLineEntry>::Initialize();
-            // Storage<SkillLineCategoryEntry>::Initialize();
-            // Storage<SkillLineAbilitySortedSpellEntry>::Initialize();
-            // Storage<SkillLineAbilityEntry>::Initialize();
-            // Storage<ServerMessagesEntry>::Initialize();
-            // Storage<ScreenLocationEntry>::Initialize();
-            // Storage<ScreenEffectEntry>::Initialize();
-            // Storage<ScalingStatValuesEntry>::Initialize();
-            // Storage<ScalingStatDistributionEntry>::Initialize();
-            // Storage<RandPropPointsEntry>::Initialize();
-            // Storage<ResearchSiteEntry>::Initialize();
-            // Storage<ResearchProjectEntry>::Initialize();
-            // Storage<ResearchFieldEntry>::Initialize();
-            // Storage<ResearchBranchEntry>::Initialize();
-            // Storage<QuestXPEntry>::Initialize();
-            // Storage<QuestSortEntry>::Initialize();
-            // Storage<QuestPOIPointEntry>::Initialize();
-            // Storage<QuestPOIBlobEntry>::Initialize();
-            // Storage<QuestInfoEntry>::Initialize();
-            // Storage<QuestFactionRewardEntry>::Initialize();
-            // Storage<PvpDifficultyEntry>::Initialize();
-            // Storage<PowerDisplayEntry>::Initialize();
-            // Storage<PlayerConditionEntry>::Initialize();
-            // Storage<PhaseXPhaseGroupEntry>::Initialize();
-            // Storage<PhaseEntry>::Initialize();
-            // Storage<PaperDollItemFrameEntry>::Initialize();
-            // Storage<PageTextMaterialEntry>::Initialize();
-            // Storage<PackageEntry>::Initialize();
-            // Storage<OverrideSpellDataEntry>::Initialize();
-            // Storage<NumTalentsAtLevelEntry>::Initialize();
-            // Storage<NPCSoundsEntry>::Initialize();
-            // Storage<MountTypeEntry>::Initialize();
-            // Storage<MountCapabilityEntry>::Initialize();
-            // Storage<MaterialEntry>::Initialize();
-            // Storage<MapDifficultyEntry>::Initialize();
-            // Storage<MailTemplateEntry>::Initialize();
-            // Storage<LockTypeEntry>::Initialize();
-            // Storage<LockEntry>::Initialize();
-            // Storage<LoadingScreenTaxiSplinesEntry>::Initialize();
-            // Storage<LfgDungeonsEntry>::Initialize();
-            // Storage<LfgDungeonsGroupingMapEntry>::Initialize();
-            // Storage<LfgDungeonGroupEntry>::Initialize();
-            // Storage<LfgDungeonExpansionEntry>::Initialize();
-            // Storage<LanguagesEntry>::Initialize();
-            // Storage<LanguageWordsEntry>::Initialize();
-            // Storage<JournalInstanceEntry>::Initialize();
-            // Storage<JournalEncounterSectionEntry>::Initialize();
-            // Storage<JournalEncounterEntry>::Initialize();
-            // Storage<JournalEncounterItemEntry>::Initialize();
-            // Storage<JournalEncounterCreatureEntry>::Initialize();
-            // Storage<ItemSubClassMaskEntry>::Initialize();
-            // Storage<ItemSetEntry>::Initialize();
-            // Storage<ItemReforgeEntry>::Initialize();
-            // Storage<ItemRandomSuffixEntry>::Initialize();
-            // Storage<ItemRandomPropertiesEntry>::Initialize();
-            // Storage<ItemPurchaseGroupEntry>::Initialize();
-            // Storage<ItemPriceBaseEntry>::Initialize();
-            // Storage<ItemPetFoodEntry>::Initialize();
-            // Storage<ItemNameDescriptionEntry>::Initialize();
-            // Storage<ItemLimitCategoryEntry>::Initialize();
-            // Storage<ItemGroupSoundsEntry>::Initialize();
-            // Storage<ItemDisenchantLootEntry>::Initialize();
-            // Storage<ItemDamageWandEntry>::Initialize();
-            // Storage<ItemDamageTwoHandCasterEntry>::Initialize();
-            // Storage<ItemDamageTwoHandEntry>::Initialize();
-            // Storage<ItemDamageThrownEntry>::Initialize();
-            // Storage<ItemDamageRangedEntry>::Initialize();
-            // Storage<ItemDamageOneHandCasterEntry>::Initialize();
-            // Storage<ItemDamageOneHandEntry>::Initialize();
-            // Storage<ItemDamageAmmoEntry>::Initialize();
-            // Storage<ItemBagFamilyEntry>::Initialize();
-            // Storage<ItemArmorShieldEntry>::Initialize();
-            // Storage<ItemArmorTotalEntry>::Initialize();
-            // Storage<ItemArmorQualityEntry>::Initialize();
-            // Storage<ImportPriceWeaponEntry>::Initialize();
-            // Storage<ImportPriceShieldEntry>::Initialize();
-            // Storage<ImportPriceQualityEntry>::Initialize();
-            // Storage<ImportPriceArmorEntry>::Initialize();
-            // Storage<HolidaysEntry>::Initialize();
-            // Storage<HolidayNamesEntry>::Initialize();
-            // Storage<HolidayDescriptionsEntry>::Initialize();
-            // Storage<GuildPerkSpellsEntry>::Initialize();
-            // Storage<gtSpellScalingEntry>::Initialize();
-            // Storage<gtRegenMPPerSptEntry>::Initialize();
-            // Storage<gtOCTRegenMPEntry>::Initialize();
-            // Storage<gtOCTHpPerStaminaEntry>::Initialize();
-            // Storage<gtOCTClassCombatRatingScalarEntry>::Initialize();
-            // Storage<gtOCTBaseMPByClassEntry>::Initialize();
-            // Storage<gtOCTBaseHPByClassEntry>::Initialize();
-            // Storage<gtNPCManaCostScalerEntry>::Initialize();
-            // Storage<gtChanceToSpellCritBaseEntry>::Initialize();
-            // Storage<gtChanceToSpellCritEntry>::Initialize();
-            // Storage<gtChanceToMeleeCritBaseEntry>::Initialize();
-            // Storage<gtChanceToMeleeCritEntry>::Initialize();
-            // Storage<gtCombatRatingsEntry>::Initialize();
-            // Storage<gtBarberShopCostBaseEntry>::Initialize();
-            // Storage<GMTicketCategoryEntry>::Initialize();
-            // Storage<GMSurveySurveysEntry>::Initialize();
-            // Storage<GMSurveyQuestionsEntry>::Initialize();
-            // Storage<GMSurveyCurrentSurveyEntry>::Initialize();
-            // Storage<GMSurveyAnswersEntry>::Initialize();
-            // Storage<GlyphSlotEntry>::Initialize();
-            // Storage<GlyphPropertiesEntry>::Initialize();
-            // Storage<GemPropertiesEntry>::Initialize();
-            // Storage<GameTablesEntry>::Initialize();
-            // Storage<GameObjectDisplayInfoEntry>::Initialize();
-            // Storage<GameObjectArtKitEntry>::Initialize();
-            // Storage<FootstepTerrainLookupEntry>::Initialize();
-            // Storage<FactionEntry>::Initialize();
-            // Storage<ExhaustionEntry>::Initialize();
-            // Storage<EnvironmentalDamageEntry>::Initialize();
-            // Storage<EmotesTextEntry>::Initialize();
-            // Storage<EmotesTextSoundEntry>::Initialize();
-            // Storage<EmotesTextDataEntry>::Initialize();
-            // Storage<EmotesEntry>::Initialize();
-            // Storage<DurabilityQualityEntry>::Initialize();
-            // Storage<DurabilityCostsEntry>::Initialize();
-            // Storage<DungeonMapChunkEntry>::Initialize();
-            // Storage<DungeonMapEntry>::Initialize();
-            // Storage<DungeonEncounterEntry>::Initialize();
-            // Storage<DestructibleModelDataEntry>::Initialize();
-            // Storage<DeathThudLookupsEntry>::Initialize();
-            // Storage<DanceMovesEntry>::Initialize();
-            // Storage<CurrencyCategoryEntry>::Initialize();
-            // Storage<CurrencyTypesEntry>::Initialize();
-            // Storage<CreatureTypeEntry>::Initialize();
-            // Storage<CreatureSpellDataEntry>::Initialize();
-            // Storage<CreatureSoundDataEntry>::Initialize();
-            // Storage<CreatureMovementInfoEntry>::Initialize();
-            // Storage<CreatureImmunitiesEntry>::Initialize();
-            // Storage<CinematicSequencesEntry>::Initialize();
-            // Storage<CinematicCameraEntry>::Initialize();
-            // Storage<ChrClassesXPowerTypesEntry>::Initialize();
-            // Storage<ChatChannelsEntry>::Initialize();
-            // Storage<CharTitlesEntry>::Initialize();
-            // Storage<CastableRaidBuffsEntry>::Initialize();
-            // Storage<CameraShakesEntry>::Initialize();
-            // Storage<CameraModeEntry>::Initialize();
-            // Storage<BattlemasterListEntry>::Initialize();
-            // Storage<BarberShopStyleEntry>::Initialize();
-            // Storage<BankBagSlotPricesEntry>::Initialize();
-            // Storage<AuctionHouseEntry>::Initialize();
-            // Storage<ArmorLocationEntry>::Initialize();
-            // Storage<AreaTriggerEntry>::Initialize();
-            // Storage<AreaAssignmentEntry>::Initialize();
-            // Storage<AreaPOISortedWorldStateEntry>::Initialize();
-            // Storage<AreaPOIEntry>::Initialize();
-            // Storage<AreaGroupEntry>::Initialize();
-            // Storage<Achievement_CategoryEntry>::Initialize();
-            // Storage<Achievement_CriteriaEntry>::Initialize();
-            // Storage<AchievementEntry>::Initialize();
-            // Storage<ItemCurrencyCostEntry>::Initialize();
-            // Storage<ItemExtendedCostEntry>::Initialize();
-            // Storage<KeyChainEntry>::Initialize();
-            // Storage<DeclinedWordCasesEntry>::Initialize();
-            // Storage<DeclinedWordEntry>::Initialize();
-            // Storage<ZoneLightPointEntry>::Initialize();
-            // Storage<ZoneLightEntry>::Initialize();
-            // Storage<WMOAreaTableEntry>::Initialize();
-            // Storage<WeatherEntry>::Initialize();
-            // Storage<TerrainTypeEntry>::Initialize();
-            // Storage<TerrainMaterialEntry>::Initialize();
-            // Storage<SoundEntriesFallbacksEntry>::Initialize();
-            // Storage<SoundEmittersEntry>::Initialize();
-            // Storage<SoundEmitterPillPointsEntry>::Initialize();
-            // Storage<LiquidTypeEntry>::Initialize();
-            // Storage<LiquidObjectEntry>::Initialize();
-            // Storage<LiquidMaterialEntry>::Initialize();
-            // Storage<LightSkyboxEntry>::Initialize();
-            // Storage<LightFloatBandEntry>::Initialize();
-            // Storage<LightEntry>::Initialize();
-            // Storage<GroundEffectTextureEntry>::Initialize();
-            // Storage<GroundEffectDoodadEntry>::Initialize();
-            // Storage<FootprintTexturesEntry>::Initialize();
-            Storage<MapEntry>::Initialize();
-            // Storage<LightParamsEntry>::Initialize();
-            // Storage<LightIntBandEntry>::Initialize();
-            // Storage<AreaTableEntry>::Initialize();
-            // Storage<AnimationDataEntry>::Initialize();
-            // Storage<SoundEntriesEntry>::Initialize();
-            // Storage<SoundEntriesAdvancedEntry>::Initialize();
-            // Storage<VideoHardwareEntry>::Initialize();
+            TableLoader loader{ GetLoaderPool() };
+            QueuePrefetchList(loader);
+
+            std::chrono::microseconds tableTime = loader.Wait();
 
             auto end = hrc::now();
 
-            LOG_INFO("DBCs loaded in {} ms", std::chrono::duration_cast<std::chrono::microseconds>(end - start).count() / 1000.0f);
+            LOG_INFO("DBCs loaded in {} ms on {} threads ({} ms of table loading)",
+                std::chrono::duration_cast<std::chrono::microseconds>(end - start).count() / 1000.0f, GetLoaderPool().size(), tableTime.count() / 1000.0f);
+
+            StringPoolStatistics strings = sStringPool->GetStatistics();
+            LOG_INFO("String pool holds {} strings in {} KB, {} KB saved by deduplication",
+                strings.StringCount, strings.StoredBytes / 1024, strings.GetSavedBytes() / 1024);
+        }
+
+        void Prefetch()
+        {
+            // Nobody waits on these; a table still loading blocks its first accessor until it is ready.
+            TableLoader loader{ GetLoaderPool() };
+            QueuePrefetchList(loader);
+        }
+
+        void BenchmarkDecoders(std::ostream& output, uint32_t iterations)
+        {
+            DecodeBenchmark benchmark{ output, std::max(iterations, 1u) };
+            ForEachTable(benchmark);
+
+            output << "All tables: " << benchmark.GenericTotal.count() / double(benchmark.Iterations) << " us generic, "
+                << benchmark.UnrolledTotal.count() / double(benchmark.Iterations) << " us unrolled" << std::endl;
+        }
+
+        void BenchmarkSyntheticTables(std::ostream& output, uint32_t recordCount)
+        {
+            SyntheticTableBenchmark benchmark{ output, std::max(recordCount, 1u) };
+
+            output << "{" << std::endl;
+            output << "  \"records_per_table\": " << benchmark.RecordCount << "," << std::endl;
+            output << "  \"tables\": [";
+
+            ForEachTable(benchmark);
+
+            StringPoolStatistics strings = sStringPool->GetStatistics();
+
+            output << std::endl << "  ]," << std::endl;
+            output << "  \"table_count\": " << benchmark.TableCount << "," << std::endl;
+            output << "  \"clamped_table_count\": " << benchmark.ClampedCount << "," << std::endl;
+            output << "  \"initialize_total_us\": " << benchmark.InitializeTotal.count() << "," << std::endl;
+            output << "  \"string_pool_bytes\": " << strings.StoredBytes << "," << std::endl;
+            output << "  \"peak_rss_bytes\": " << wowgm::utilities::GetPeakResidentSetSize() << std::endl;
+            output << "}" << std::endl;
         }
 
         template <typename T> T const* GetRecord(uint32_t index)
         {
             return Storage<T>::GetRecord(index);
         }
+
+        template AchievementEntry const* GetRecord<AchievementEntry>(uint32_t);
+        template Achievement_CategoryEntry const* GetRecord<Achievement_CategoryEntry>(uint32_t);
+        template Achievement_CriteriaEntry const* GetRecord<Achievement_CriteriaEntry>(uint32_t);
+        template AnimKitBoneSetAliasEntry const* GetRecord<AnimKitBoneSetAliasEntry>(uint32_t);
+        template AnimKitBoneSetEntry const* GetRecord<AnimKitBoneSetEntry>(uint32_t);
+        template AnimKitConfigBoneSetEntry const* GetRecord<AnimKitConfigBoneSetEntry>(uint32_t);
+        template AnimKitConfigEntry const* GetRecord<AnimKitConfigEntry>(uint32_t);
+        template AnimKitEntry const* GetRecord<AnimKitEntry>(uint32_t);
+        template AnimKitPriorityEntry const* GetRecord<AnimKitPriorityEntry>(uint32_t);
+        template AnimKitSegmentEntry const* GetRecord<AnimKitSegmentEntry>(uint32_t);
+        template AnimReplacementEntry const* GetRecord<AnimReplacementEntry>(uint32_t);
+        template AnimReplacementSetEntry const* GetRecord<AnimReplacementSetEntry>(uint32_t);
+        template AnimationDataEntry const* GetRecord<AnimationDataEntry>(uint32_t);
+        template AreaAssignmentEntry const* GetRecord<AreaAssignmentEntry>(uint32_t);
+        template AreaGroupEntry const* GetRecord<AreaGroupEntry>(uint32_t);
+        template AreaPOIEntry const* GetRecord<AreaPOIEntry>(uint32_t);
+        template AreaPOISortedWorldStateEntry const* GetRecord<AreaPOISortedWorldStateEntry>(uint32_t);
+        template AreaTableEntry const* GetRecord<AreaTableEntry>(uint32_t);
+        template AreaTriggerEntry const* GetRecord<AreaTriggerEntry>(uint32_t);
+        template ArmorLocationEntry const* GetRecord<ArmorLocationEntry>(uint32_t);
+        template AuctionHouseEntry const* GetRecord<AuctionHouseEntry>(uint32_t);
+        template BankBagSlotPricesEntry const* GetRecord<BankBagSlotPricesEntry>(uint32_t);
+        template BannedAddOnsEntry const* GetRecord<BannedAddOnsEntry>(uint32_t);
+        template BarberShopStyleEntry const* GetRecord<BarberShopStyleEntry>(uint32_t);
+        template BattlemasterListEntry const* GetRecord<BattlemasterListEntry>(uint32_t);
+        template CameraModeEntry const* GetRecord<CameraModeEntry>(uint32_t);
+        template CameraShakesEntry const* GetRecord<CameraShakesEntry>(uint32_t);
+        template CastableRaidBuffsEntry const* GetRecord<CastableRaidBuffsEntry>(uint32_t);
+        template Cfg_CategoriesEntry const* GetRecord<Cfg_CategoriesEntry>(uint32_t);
+        template Cfg_ConfigsEntry const* GetRecord<Cfg_ConfigsEntry>(uint32_t);
+        template CharBaseInfoEntry const* GetRecord<CharBaseInfoEntry>(uint32_t);
+        template CharHairGeosetsEntry const* GetRecord<CharHairGeosetsEntry>(uint32_t);
+        template CharSectionsEntry const* GetRecord<CharSectionsEntry>(uint32_t);
+        template CharStartOutfitEntry const* GetRecord<CharStartOutfitEntry>(uint32_t);
+        template CharTitlesEntry const* GetRecord<CharTitlesEntry>(uint32_t);
+        template CharacterFacialHairStylesEntry const* GetRecord<CharacterFacialHairStylesEntry>(uint32_t);
+        template ChatChannelsEntry const* GetRecord<ChatChannelsEntry>(uint32_t);
+        template ChatProfanityEntry const* GetRecord<ChatProfanityEntry>(uint32_t);
+        template ChrClassesEntry const* GetRecord<ChrClassesEntry>(uint32_t);
+        template ChrClassesXPowerTypesEntry const* GetRecord<ChrClassesXPowerTypesEntry>(uint32_t);
+        template ChrRacesEntry const* GetRecord<ChrRacesEntry>(uint32_t);
+        template CinematicCameraEntry const* GetRecord<CinematicCameraEntry>(uint32_t);
+        template CinematicSequencesEntry const* GetRecord<CinematicSequencesEntry>(uint32_t);
+        template CreatureDisplayInfoEntry const* GetRecord<CreatureDisplayInfoEntry>(uint32_t);
+        template CreatureDisplayInfoExtraEntry const* GetRecord<CreatureDisplayInfoExtraEntry>(uint32_t);
+        template CreatureFamilyEntry const* GetRecord<CreatureFamilyEntry>(uint32_t);
+        template CreatureImmunitiesEntry const* GetRecord<CreatureImmunitiesEntry>(uint32_t);
+        template CreatureModelDataEntry const* GetRecord<CreatureModelDataEntry>(uint32_t);
+        template CreatureMovementInfoEntry const* GetRecord<CreatureMovementInfoEntry>(uint32_t);
+        template CreatureSoundDataEntry const* GetRecord<CreatureSoundDataEntry>(uint32_t);
+        template CreatureSpellDataEntry const* GetRecord<CreatureSpellDataEntry>(uint32_t);
+        template CreatureTypeEntry const* GetRecord<CreatureTypeEntry>(uint32_t);
+        template CurrencyCategoryEntry const* GetRecord<CurrencyCategoryEntry>(uint32_t);
+        template CurrencyTypesEntry const* GetRecord<CurrencyTypesEntry>(uint32_t);
+        template DanceMovesEntry const* GetRecord<DanceMovesEntry>(uint32_t);
+        template DeathThudLookupsEntry const* GetRecord<DeathThudLookupsEntry>(uint32_t);
+        template DeclinedWordCasesEntry const* GetRecord<DeclinedWordCasesEntry>(uint32_t);
+        template DeclinedWordEntry const* GetRecord<DeclinedWordEntry>(uint32_t);
+        template DestructibleModelDataEntry const* GetRecord<DestructibleModelDataEntry>(uint32_t);
+        template DungeonEncounterEntry const* GetRecord<DungeonEncounterEntry>(uint32_t);
+        template DungeonMapChunkEntry const* GetRecord<DungeonMapChunkEntry>(uint32_t);
+        template DungeonMapEntry const* GetRecord<DungeonMapEntry>(uint32_t);
+        template DurabilityCostsEntry const* GetRecord<DurabilityCostsEntry>(uint32_t);
+        template DurabilityQualityEntry const* GetRecord<DurabilityQualityEntry>(uint32_t);
+        template EmotesEntry const* GetRecord<EmotesEntry>(uint32_t);
+        template EmotesTextDataEntry const* GetRecord<EmotesTextDataEntry>(uint32_t);
+        template EmotesTextEntry const* GetRecord<EmotesTextEntry>(uint32_t);
+        template EmotesTextSoundEntry const* GetRecord<EmotesTextSoundEntry>(uint32_t);
+        template EnvironmentalDamageEntry const* GetRecord<EnvironmentalDamageEntry>(uint32_t);
+        template ExhaustionEntry const* GetRecord<ExhaustionEntry>(uint32_t);
+        template FactionEntry const* GetRecord<FactionEntry>(uint32_t);
+        template FactionGroupEntry const* GetRecord<FactionGroupEntry>(uint32_t);
+        template FactionTemplateEntry const* GetRecord<FactionTemplateEntry>(uint32_t);
+        template FileDataEntry const* GetRecord<FileDataEntry>(uint32_t);
+        template FootprintTexturesEntry const* GetRecord<FootprintTexturesEntry>(uint32_t);
+        template FootstepTerrainLookupEntry const* GetRecord<FootstepTerrainLookupEntry>(uint32_t);
+        template GMSurveyAnswersEntry const* GetRecord<GMSurveyAnswersEntry>(uint32_t);
+        template GMSurveyCurrentSurveyEntry const* GetRecord<GMSurveyCurrentSurveyEntry>(uint32_t);
+        template GMSurveyQuestionsEntry const* GetRecord<GMSurveyQuestionsEntry>(uint32_t);
+        template GMSurveySurveysEntry const* GetRecord<GMSurveySurveysEntry>(uint32_t);
+        template GMTicketCategoryEntry const* GetRecord<GMTicketCategoryEntry>(uint32_t);
+        template GameObjectArtKitEntry const* GetRecord<GameObjectArtKitEntry>(uint32_t);
+        template GameObjectDisplayInfoEntry const* GetRecord<GameObjectDisplayInfoEntry>(uint32_t);
+        template GameTablesEntry const* GetRecord<GameTablesEntry>(uint32_t);
+        template GameTipsEntry const* GetRecord<GameTipsEntry>(uint32_t);
+        template GemPropertiesEntry const* GetRecord<GemPropertiesEntry>(uint32_t);
+        template GlueScreenEmoteEntry const* GetRecord<GlueScreenEmoteEntry>(uint32_t);
+        template GlyphPropertiesEntry const* GetRecord<GlyphPropertiesEntry>(uint32_t);
+        template GlyphSlotEntry const* GetRecord<GlyphSlotEntry>(uint32_t);
+        template GroundEffectDoodadEntry const* GetRecord<GroundEffectDoodadEntry>(uint32_t);
+        template GroundEffectTextureEntry const* GetRecord<GroundEffectTextureEntry>(uint32_t);
+        template GuildColorBackgroundEntry const* GetRecord<GuildColorBackgroundEntry>(uint32_t);
+        template GuildColorBorderEntry const* GetRecord<GuildColorBorderEntry>(uint32_t);
+        template GuildColorEmblemEntry const* GetRecord<GuildColorEmblemEntry>(uint32_t);
+        template GuildPerkSpellsEntry const* GetRecord<GuildPerkSpellsEntry>(uint32_t);
+        template HelmetGeosetVisDataEntry const* GetRecord<HelmetGeosetVisDataEntry>(uint32_t);
+        template HolidayDescriptionsEntry const* GetRecord<HolidayDescriptionsEntry>(uint32_t);
+        template HolidayNamesEntry const* GetRecord<HolidayNamesEntry>(uint32_t);
+        template HolidaysEntry const* GetRecord<HolidaysEntry>(uint32_t);
+        template ImportPriceArmorEntry const* GetRecord<ImportPriceArmorEntry>(uint32_t);
+        template ImportPriceQualityEntry const* GetRecord<ImportPriceQualityEntry>(uint32_t);
+        template ImportPriceShieldEntry const* GetRecord<ImportPriceShieldEntry>(uint32_t);
+        template ImportPriceWeaponEntry const* GetRecord<ImportPriceWeaponEntry>(uint32_t);
+        template ItemArmorQualityEntry const* GetRecord<ItemArmorQualityEntry>(uint32_t);
+        template ItemArmorShieldEntry const* GetRecord<ItemArmorShieldEntry>(uint32_t);
+        template ItemArmorTotalEntry const* GetRecord<ItemArmorTotalEntry>(uint32_t);
+        template ItemBagFamilyEntry const* GetRecord<ItemBagFamilyEntry>(uint32_t);
+        template ItemClassEntry const* GetRecord<ItemClassEntry>(uint32_t);
+        template ItemCurrencyCostEntry const* GetRecord<ItemCurrencyCostEntry>(uint32_t);
+        template ItemDamageAmmoEntry const* GetRecord<ItemDamageAmmoEntry>(uint32_t);
+        template ItemDamageOneHandCasterEntry const* GetRecord<ItemDamageOneHandCasterEntry>(uint32_t);
+        template ItemDamageOneHandEntry const* GetRecord<ItemDamageOneHandEntry>(uint32_t);
+        template ItemDamageRangedEntry const* GetRecord<ItemDamageRangedEntry>(uint32_t);
+        template ItemDamageThrownEntry const* GetRecord<ItemDamageThrownEntry>(uint32_t);
+        template ItemDamageTwoHandCasterEntry const* GetRecord<ItemDamageTwoHandCasterEntry>(uint32_t);
+        template ItemDamageTwoHandEntry const* GetRecord<ItemDamageTwoHandEntry>(uint32_t);
+        template ItemDamageWandEntry const* GetRecord<ItemDamageWandEntry>(uint32_t);
+        template ItemDisenchantLootEntry const* GetRecord<ItemDisenchantLootEntry>(uint32_t);
+        template ItemDisplayInfoEntry const* GetRecord<ItemDisplayInfoEntry>(uint32_t);
+        template ItemEntry const* GetRecord<ItemEntry>(uint32_t);
+        template ItemExtendedCostEntry const* GetRecord<ItemExtendedCostEntry>(uint32_t);
+        template ItemGroupSoundsEntry const* GetRecord<ItemGroupSoundsEntry>(uint32_t);
+        template ItemLimitCategoryEntry const* GetRecord<ItemLimitCategoryEntry>(uint32_t);
+        template ItemNameDescriptionEntry const* GetRecord<ItemNameDescriptionEntry>(uint32_t);
+        template ItemPetFoodEntry const* GetRecord<ItemPetFoodEntry>(uint32_t);
+        template ItemPriceBaseEntry const* GetRecord<ItemPriceBaseEntry>(uint32_t);
+        template ItemPurchaseGroupEntry const* GetRecord<ItemPurchaseGroupEntry>(uint32_t);
+        template ItemRandomPropertiesEntry const* GetRecord<ItemRandomPropertiesEntry>(uint32_t);
+        template ItemRandomSuffixEntry const* GetRecord<ItemRandomSuffixEntry>(uint32_t);
+        template ItemReforgeEntry const* GetRecord<ItemReforgeEntry>(uint32_t);
+        template ItemSetEntry const* GetRecord<ItemSetEntry>(uint32_t);
+        template ItemSparseEntry const* GetRecord<ItemSparseEntry>(uint32_t);
+        template ItemSubClassEntry const* GetRecord<ItemSubClassEntry>(uint32_t);
+        template ItemSubClassMaskEntry const* GetRecord<ItemSubClassMaskEntry>(uint32_t);
+        template ItemVisualEffectsEntry const* GetRecord<ItemVisualEffectsEntry>(uint32_t);
+        template ItemVisualsEntry const* GetRecord<ItemVisualsEntry>(uint32_t);
+        template JournalEncounterCreatureEntry const* GetRecord<JournalEncounterCreatureEntry>(uint32_t);
+        template JournalEncounterEntry const* GetRecord<JournalEncounterEntry>(uint32_t);
+        template JournalEncounterItemEntry const* GetRecord<JournalEncounterItemEntry>(uint32_t);
+        template JournalEncounterSectionEntry const* GetRecord<JournalEncounterSectionEntry>(uint32_t);
+        template JournalInstanceEntry const* GetRecord<JournalInstanceEntry>(uint32_t);
+        template KeyChainEntry const* GetRecord<KeyChainEntry>(uint32_t);
+        template LanguageWordsEntry const* GetRecord<LanguageWordsEntry>(uint32_t);
+        template LanguagesEntry const* GetRecord<LanguagesEntry>(uint32_t);
+        template LfgDungeonExpansionEntry const* GetRecord<LfgDungeonExpansionEntry>(uint32_t);
+        template LfgDungeonGroupEntry const* GetRecord<LfgDungeonGroupEntry>(uint32_t);
+        template LfgDungeonsEntry const* GetRecord<LfgDungeonsEntry>(uint32_t);
+        template LfgDungeonsGroupingMapEntry const* GetRecord<LfgDungeonsGroupingMapEntry>(uint32_t);
+        template LightEntry const* GetRecord<LightEntry>(uint32_t);
+        template LightFloatBandEntry const* GetRecord<LightFloatBandEntry>(uint32_t);
+        template LightIntBandEntry const* GetRecord<LightIntBandEntry>(uint32_t);
+        template LightParamsEntry const* GetRecord<LightParamsEntry>(uint32_t);
+        template LightSkyboxEntry const* GetRecord<LightSkyboxEntry>(uint32_t);
+        template LiquidMaterialEntry const* GetRecord<LiquidMaterialEntry>(uint32_t);
+        template LiquidObjectEntry const* GetRecord<LiquidObjectEntry>(uint32_t);
+        template LiquidTypeEntry const* GetRecord<LiquidTypeEntry>(uint32_t);
+        template LoadingScreenTaxiSplinesEntry const* GetRecord<LoadingScreenTaxiSplinesEntry>(uint32_t);
+        template LoadingScreensEntry const* GetRecord<LoadingScreensEntry>(uint32_t);
+        template LockEntry const* GetRecord<LockEntry>(uint32_t);
+        template LockTypeEntry const* GetRecord<LockTypeEntry>(uint32_t);
+        template MailTemplateEntry const* GetRecord<MailTemplateEntry>(uint32_t);
+        template MapDifficultyEntry const* GetRecord<MapDifficultyEntry>(uint32_t);
+        template MapEntry const* GetRecord<MapEntry>(uint32_t);
+        template MaterialEntry const* GetRecord<MaterialEntry>(uint32_t);
+        template MountCapabilityEntry const* GetRecord<MountCapabilityEntry>(uint32_t);
+        template MountTypeEntry const* GetRecord<MountTypeEntry>(uint32_t);
+        template MovieEntry const* GetRecord<MovieEntry>(uint32_t);
+        template MovieFileDataEntry const* GetRecord<MovieFileDataEntry>(uint32_t);
+        template MovieVariationEntry const* GetRecord<MovieVariationEntry>(uint32_t);
+        template NPCSoundsEntry const* GetRecord<NPCSoundsEntry>(uint32_t);
+        template NameGenEntry const* GetRecord<NameGenEntry>(uint32_t);
+        template NamesProfanityEntry const* GetRecord<NamesProfanityEntry>(uint32_t);
+        template NamesReservedEntry const* GetRecord<NamesReservedEntry>(uint32_t);
+        template NumTalentsAtLevelEntry const* GetRecord<NumTalentsAtLevelEntry>(uint32_t);
+        template ObjectEffectEntry const* GetRecord<ObjectEffectEntry>(uint32_t);
+        template ObjectEffectGroupEntry const* GetRecord<ObjectEffectGroupEntry>(uint32_t);
+        template ObjectEffectModifierEntry const* GetRecord<ObjectEffectModifierEntry>(uint32_t);
+        template ObjectEffectPackageElemEntry const* GetRecord<ObjectEffectPackageElemEntry>(uint32_t);
+        template ObjectEffectPackageEntry const* GetRecord<ObjectEffectPackageEntry>(uint32_t);
+        template OverrideSpellDataEntry const* GetRecord<OverrideSpellDataEntry>(uint32_t);
+        template PackageEntry const* GetRecord<PackageEntry>(uint32_t);
+        template PageTextMaterialEntry const* GetRecord<PageTextMaterialEntry>(uint32_t);
+        template PaperDollItemFrameEntry const* GetRecord<PaperDollItemFrameEntry>(uint32_t);
+        template ParticleColorEntry const* GetRecord<ParticleColorEntry>(uint32_t);
+        template PhaseEntry const* GetRecord<PhaseEntry>(uint32_t);
+        template PhaseShiftZoneSoundsEntry const* GetRecord<PhaseShiftZoneSoundsEntry>(uint32_t);
+        template PhaseXPhaseGroupEntry const* GetRecord<PhaseXPhaseGroupEntry>(uint32_t);
+        template PlayerConditionEntry const* GetRecord<PlayerConditionEntry>(uint32_t);
+        template PowerDisplayEntry const* GetRecord<PowerDisplayEntry>(uint32_t);
+        template PvpDifficultyEntry const* GetRecord<PvpDifficultyEntry>(uint32_t);
+        template QuestFactionRewardEntry const* GetRecord<QuestFactionRewardEntry>(uint32_t);
+        template QuestInfoEntry const* GetRecord<QuestInfoEntry>(uint32_t);
+        template QuestPOIBlobEntry const* GetRecord<QuestPOIBlobEntry>(uint32_t);
+        template QuestPOIPointEntry const* GetRecord<QuestPOIPointEntry>(uint32_t);
+        template QuestSortEntry const* GetRecord<QuestSortEntry>(uint32_t);
+        template QuestXPEntry const* GetRecord<QuestXPEntry>(uint32_t);
+        template RandPropPointsEntry const* GetRecord<RandPropPointsEntry>(uint32_t);
+        template ResearchBranchEntry const* GetRecord<ResearchBranchEntry>(uint32_t);
+        template ResearchFieldEntry const* GetRecord<ResearchFieldEntry>(uint32_t);
+        template ResearchProjectEntry const* GetRecord<ResearchProjectEntry>(uint32_t);
+        template ResearchSiteEntry const* GetRecord<ResearchSiteEntry>(uint32_t);
+        template ResistancesEntry const* GetRecord<ResistancesEntry>(uint32_t);
+        template ScalingStatDistributionEntry const* GetRecord<ScalingStatDistributionEntry>(uint32_t);
+        template ScalingStatValuesEntry const* GetRecord<ScalingStatValuesEntry>(uint32_t);
+        template ScreenEffectEntry const* GetRecord<ScreenEffectEntry>(uint32_t);
+        template ScreenLocationEntry const* GetRecord<ScreenLocationEntry>(uint32_t);
+        template ServerMessagesEntry const* GetRecord<ServerMessagesEntry>(uint32_t);
+        template SkillLineAbilityEntry const* GetRecord<SkillLineAbilityEntry>(uint32_t);
+        template SkillLineAbilitySortedSpellEntry const* GetRecord<SkillLineAbilitySortedSpellEntry>(uint32_t);
+        template SkillLineCategoryEntry const* GetRecord<SkillLineCategoryEntry>(uint32_t);
+        template SkillLineEntry const* GetRecord<SkillLineEntry>(uint32_t);
+        template SkillRaceClassInfoEntry const* GetRecord<SkillRaceClassInfoEntry>(uint32_t);
+        template SkillTiersEntry const* GetRecord<SkillTiersEntry>(uint32_t);
+        template SoundAmbienceEntry const* GetRecord<SoundAmbienceEntry>(uint32_t);
+        template SoundAmbienceFlavorEntry const* GetRecord<SoundAmbienceFlavorEntry>(uint32_t);
+        template SoundEmitterPillPointsEntry const* GetRecord<SoundEmitterPillPointsEntry>(uint32_t);
+        template SoundEmittersEntry const* GetRecord<SoundEmittersEntry>(uint32_t);
+        template SoundEntriesAdvancedEntry const* GetRecord<SoundEntriesAdvancedEntry>(uint32_t);
+        template SoundEntriesEntry const* GetRecord<SoundEntriesEntry>(uint32_t);
+        template SoundEntriesFallbacksEntry const* GetRecord<SoundEntriesFallbacksEntry>(uint32_t);
+        template SoundFilterElemEntry const* GetRecord<SoundFilterElemEntry>(uint32_t);
+        template SoundFilterEntry const* GetRecord<SoundFilterEntry>(uint32_t);
+        template SoundProviderPreferencesEntry const* GetRecord<SoundProviderPreferencesEntry>(uint32_t);
+        template SpamMessagesEntry const* GetRecord<SpamMessagesEntry>(uint32_t);
+        template SpellActivationOverlayEntry const* GetRecord<SpellActivationOverlayEntry>(uint32_t);
+        template SpellAuraOptionsEntry const* GetRecord<SpellAuraOptionsEntry>(uint32_t);
+        template SpellAuraRestrictionsEntry const* GetRecord<SpellAuraRestrictionsEntry>(uint32_t);
+        template SpellAuraVisXTalentTabEntry const* GetRecord<SpellAuraVisXTalentTabEntry>(uint32_t);
+        template SpellAuraVisibilityEntry const* GetRecord<SpellAuraVisibilityEntry>(uint32_t);
+        template SpellCastTimesEntry const* GetRecord<SpellCastTimesEntry>(uint32_t);
+        template SpellCastingRequirementsEntry const* GetRecord<SpellCastingRequirementsEntry>(uint32_t);
+        template SpellCategoriesEntry const* GetRecord<SpellCategoriesEntry>(uint32_t);
+        template SpellCategoryEntry const* GetRecord<SpellCategoryEntry>(uint32_t);
+        template SpellChainEffectsEntry const* GetRecord<SpellChainEffectsEntry>(uint32_t);
+        template SpellClassOptionsEntry const* GetRecord<SpellClassOptionsEntry>(uint32_t);
+        template SpellCooldownsEntry const* GetRecord<SpellCooldownsEntry>(uint32_t);
+        template SpellDescriptionVariablesEntry const* GetRecord<SpellDescriptionVariablesEntry>(uint32_t);
+        template SpellDifficultyEntry const* GetRecord<SpellDifficultyEntry>(uint32_t);
+        template SpellDispelTypeEntry const* GetRecord<SpellDispelTypeEntry>(uint32_t);
+        template SpellDurationEntry const* GetRecord<SpellDurationEntry>(uint32_t);
+        template SpellEffectCameraShakesEntry const* GetRecord<SpellEffectCameraShakesEntry>(uint32_t);
+        template SpellEffectEntry const* GetRecord<SpellEffectEntry>(uint32_t);
+        template SpellEntry const* GetRecord<SpellEntry>(uint32_t);
+        template SpellEquippedItemsEntry const* GetRecord<SpellEquippedItemsEntry>(uint32_t);
+        template SpellFlyoutEntry const* GetRecord<SpellFlyoutEntry>(uint32_t);
+        template SpellFlyoutItemEntry const* GetRecord<SpellFlyoutItemEntry>(uint32_t);
+        template SpellFocusObjectEntry const* GetRecord<SpellFocusObjectEntry>(uint32_t);
+        template SpellIconEntry const* GetRecord<SpellIconEntry>(uint32_t);
+        template SpellInterruptsEntry const* GetRecord<SpellInterruptsEntry>(uint32_t);
+        template SpellItemEnchantmentConditionEntry const* GetRecord<SpellItemEnchantmentConditionEntry>(uint32_t);
+        template SpellItemEnchantmentEntry const* GetRecord<SpellItemEnchantmentEntry>(uint32_t);
+        template SpellLevelsEntry const* GetRecord<SpellLevelsEntry>(uint32_t);
+        template SpellMechanicEntry const* GetRecord<SpellMechanicEntry>(uint32_t);
+        template SpellMissileEntry const* GetRecord<SpellMissileEntry>(uint32_t);
+        template SpellMissileMotionEntry const* GetRecord<SpellMissileMotionEntry>(uint32_t);
+        template SpellPowerEntry const* GetRecord<SpellPowerEntry>(uint32_t);
+        template SpellRadiusEntry const* GetRecord<SpellRadiusEntry>(uint32_t);
+        template SpellRangeEntry const* GetRecord<SpellRangeEntry>(uint32_t);
+        template SpellReagentsEntry const* GetRecord<SpellReagentsEntry>(uint32_t);
+        template SpellRuneCostEntry const* GetRecord<SpellRuneCostEntry>(uint32_t);
+        template SpellScalingEntry const* GetRecord<SpellScalingEntry>(uint32_t);
+        template SpellShapeshiftEntry const* GetRecord<SpellShapeshiftEntry>(uint32_t);
+        template SpellShapeshiftFormEntry const* GetRecord<SpellShapeshiftFormEntry>(uint32_t);
+        template SpellSpecialUnitEffectEntry const* GetRecord<SpellSpecialUnitEffectEntry>(uint32_t);
+        template SpellTargetRestrictionsEntry const* GetRecord<SpellTargetRestrictionsEntry>(uint32_t);
+        template SpellTotemsEntry const* GetRecord<SpellTotemsEntry>(uint32_t);
+        template SpellVisualEffectNameEntry const* GetRecord<SpellVisualEffectNameEntry>(uint32_t);
+        template SpellVisualEntry const* GetRecord<SpellVisualEntry>(uint32_t);
+        template SpellVisualKitAreaModelEntry const* GetRecord<SpellVisualKitAreaModelEntry>(uint32_t);
+        template SpellVisualKitEntry const* GetRecord<SpellVisualKitEntry>(uint32_t);
+        template SpellVisualKitModelAttachEntry const* GetRecord<SpellVisualKitModelAttachEntry>(uint32_t);
+        template Startup_StringsEntry const* GetRecord<Startup_StringsEntry>(uint32_t);
+        template StationeryEntry const* GetRecord<StationeryEntry>(uint32_t);
+        template StringLookupsEntry const* GetRecord<StringLookupsEntry>(uint32_t);
+        template SummonPropertiesEntry const* GetRecord<SummonPropertiesEntry>(uint32_t);
+        template TalentEntry const* GetRecord<TalentEntry>(uint32_t);
+        template TalentTabEntry const* GetRecord<TalentTabEntry>(uint32_t);
+        template TalentTreePrimarySpellsEntry const* GetRecord<TalentTreePrimarySpellsEntry>(uint32_t);
+        template TaxiNodesEntry const* GetRecord<TaxiNodesEntry>(uint32_t);
+        template TaxiPathEntry const* GetRecord<TaxiPathEntry>(uint32_t);
+        template TaxiPathNodeEntry const* GetRecord<TaxiPathNodeEntry>(uint32_t);
+        template TerrainMaterialEntry const* GetRecord<TerrainMaterialEntry>(uint32_t);
+        template TerrainTypeEntry const* GetRecord<TerrainTypeEntry>(uint32_t);
+        template TerrainTypeSoundsEntry const* GetRecord<TerrainTypeSoundsEntry>(uint32_t);
+        template TotemCategoryEntry const* GetRecord<TotemCategoryEntry>(uint32_t);
+        template TransportAnimationEntry const* GetRecord<TransportAnimationEntry>(uint32_t);
+        template TransportPhysicsEntry const* GetRecord<TransportPhysicsEntry>(uint32_t);
+        template TransportRotationEntry const* GetRecord<TransportRotationEntry>(uint32_t);
+        template UnitBloodEntry const* GetRecord<UnitBloodEntry>(uint32_t);
+        template UnitBloodLevelsEntry const* GetRecord<UnitBloodLevelsEntry>(uint32_t);
+        template UnitPowerBarEntry const* GetRecord<UnitPowerBarEntry>(uint32_t);
+        template VehicleEntry const* GetRecord<VehicleEntry>(uint32_t);
+        template VehicleSeatEntry const* GetRecord<VehicleSeatEntry>(uint32_t);
+        template VehicleUIIndSeatEntry const* GetRecord<VehicleUIIndSeatEntry>(uint32_t);
+        template VehicleUIIndicatorEntry const* GetRecord<VehicleUIIndicatorEntry>(uint32_t);
+        template VideoHardwareEntry const* GetRecord<VideoHardwareEntry>(uint32_t);
+        template VocalUISoundsEntry const* GetRecord<VocalUISoundsEntry>(uint32_t);
+        template WMOAreaTableEntry const* GetRecord<WMOAreaTableEntry>(uint32_t);
+        template WeaponImpactSoundsEntry const* GetRecord<WeaponImpactSoundsEntry>(uint32_t);
+        template WeaponSwingSounds2Entry const* GetRecord<WeaponSwingSounds2Entry>(uint32_t);
+        template WeatherEntry const* GetRecord<WeatherEntry>(uint32_t);
+        template WorldChunkSoundsEntry const* GetRecord<WorldChunkSoundsEntry>(uint32_t);
+        template WorldMapAreaEntry const* GetRecord<WorldMapAreaEntry>(uint32_t);
+        template WorldMapContinentEntry const* GetRecord<WorldMapContinentEntry>(uint32_t);
+        template WorldMapOverlayEntry const* GetRecord<WorldMapOverlayEntry>(uint32_t);
+        template WorldMapTransformsEntry const* GetRecord<WorldMapTransformsEntry>(uint32_t);
+        template WorldSafeLocsEntry const* GetRecord<WorldSafeLocsEntry>(uint32_t);
+        template WorldStateUIEntry const* GetRecord<WorldStateUIEntry>(uint32_t);
+        template WorldStateZoneSoundsEntry const* GetRecord<WorldStateZoneSoundsEntry>(uint32_t);
+        template World_PVP_AreaEntry const* GetRecord<World_PVP_AreaEntry>(uint32_t);
+        template ZoneIntroMusicTableEntry const* GetRecord<ZoneIntroMusicTableEntry>(uint32_t);
+        template ZoneLightEntry const* GetRecord<ZoneLightEntry>(uint32_t);
+        template ZoneLightPointEntry const* GetRecord<ZoneLightPointEntry>(uint32_t);
+        template ZoneMusicEntry const* GetRecord<ZoneMusicEntry>(uint32_t);
+        template gtBarberShopCostBaseEntry const* GetRecord<gtBarberShopCostBaseEntry>(uint32_t);
+        template gtChanceToMeleeCritBaseEntry const* GetRecord<gtChanceToMeleeCritBaseEntry>(uint32_t);
+        template gtChanceToMeleeCritEntry const* GetRecord<gtChanceToMeleeCritEntry>(uint32_t);
+        template gtChanceToSpellCritBaseEntry const* GetRecord<gtChanceToSpellCritBaseEntry>(uint32_t);
+        template gtChanceToSpellCritEntry const* GetRecord<gtChanceToSpellCritEntry>(uint32_t);
+        template gtCombatRatingsEntry const* GetRecord<gtCombatRatingsEntry>(uint32_t);
+        template gtNPCManaCostScalerEntry const* GetRecord<gtNPCManaCostScalerEntry>(uint32_t);
+        template gtOCTBaseHPByClassEntry const* GetRecord<gtOCTBaseHPByClassEntry>(uint32_t);
+        template gtOCTBaseMPByClassEntry const* GetRecord<gtOCTBaseMPByClassEntry>(uint32_t);
+        template gtOCTClassCombatRatingScalarEntry const* GetRecord<gtOCTClassCombatRatingScalarEntry>(uint32_t);
+        template gtOCTHpPerStaminaEntry const* GetRecord<gtOCTHpPerStaminaEntry>(uint32_t);
+        template gtOCTRegenMPEntry const* GetRecord<gtOCTRegenMPEntry>(uint32_t);
+        template gtRegenMPPerSptEntry const* GetRecord<gtRegenMPPerSptEntry>(uint32_t);
+        template gtSpellScalingEntry const* GetRecord<gtSpellScalingEntry>(uint32_t);
     }
 }
@@ -1,14 +1,28 @@
 #pragma once
 
 #include <cstdint>
+#include <ostream>
 
-// AUTOGENERATED FILE - DO NOT EDIT
-// See contrib/dbmeta.py
+// Maintained by hand; contrib/dbmeta.py only generates the table metadata in DBCMeta.hpp.
 namespace wowgm::game::datastores
 {
     namespace DataStores {
+        /// Loads the prefetch list and waits for it.
         void Initialize();
 
+        /// Starts loading the prefetch list in the background and returns immediately.
+        void Prefetch();
+
+        /// Times the record decoders of every table found in the MPQ archives, averaged over {@param iterations} runs.
+        void BenchmarkDecoders(std::ostream& output, uint32_t iterations);
+
+        /**
+         * Loads every table from synthetic files of {@param recordCount} records built from its meta, so that no client
+         * is needed, and writes load time, peak RSS, lookup and scan costs to {@param output} as JSON. Replaces loaded tables.
+         * Tables whose index column is too narrow for that many distinct IDs get fewer records and are flagged as clamped.
+         */
+        void BenchmarkSyntheticTables(std::ostream& output, uint32_t recordCount);
+
         template <typename T> T const* GetRecord(uint32_t index);
     }
 }
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "DBC.hpp"
+#include "ForeignKey.hpp"
 
 #include <cstddef>
 #include <type_traits>
@@ -10,6 +11,8 @@
 // See contrib/dbmeta.py
 namespace wowgm::game::datastores
 {
+    struct ItemDisplayInfoEntry;
+
 #pragma pack(push, 1)
     struct Startup_StringsEntry {
         uint32_t ID;
@@ -101,7 +104,7 @@ namespace wowgm::game::datastores
         uint32_t UnkMember2;
         uint32_t UnkMember3;
         uint32_t UnkMember4;
-        uint32_t UnkMember5;
+        structures::ForeignKey<ItemDisplayInfoEntry> DisplayInfoID;
         uint32_t UnkMember6;
         uint32_t UnkMember7;
     };
@@ -404,9 +407,9 @@ namespace wowgm::game::datastores
 #pragma pack(push, 1)
     struct CreatureDisplayInfoEntry {
         uint32_t ID;
-        uint32_t ModelID;
+        structures::ForeignKey<CreatureModelDataEntry> ModelID;
         uint32_t SoundID;
-        uint32_t ExtendedDisplayInfoID;
+        structures::ForeignKey<CreatureDisplayInfoExtraEntry> ExtendedDisplayInfoID;
         float ModelScale;
         uint32_t ModelAlpha;
         const char* TextureVariations[3];
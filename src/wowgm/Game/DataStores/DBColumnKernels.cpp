@@ -0,0 +1,125 @@
+#include "DBColumnKernels.hpp"
+
+#include <bitset>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+# define COLUMN_KERNELS_SSE2
+# include <emmintrin.h>
+#endif
+
+namespace wowgm::game::datastores::kernels
+{
+    namespace
+    {
+        template <typename V>
+        void FilterRangeScalar(V const* values, size_t first, size_t count, V lower, V upper, uint64_t* selection)
+        {
+            for (size_t i = first; i < count; ++i)
+            {
+                if (values[i] < lower || values[i] > upper)
+                    selection[i / 64] &= ~(uint64_t(1) << (i % 64));
+            }
+        }
+
+#ifdef COLUMN_KERNELS_SSE2
+        /**
+         * Evaluates 64 values per selection word, 4 per SSE2 comparison. {@param test} returns a lane mask of the
+         * values that pass; words that are already empty are skipped.
+         */
+        template <typename V, typename Load, typename Test>
+        size_t FilterRangeWords(V const* values, size_t count, uint64_t* selection, Load&& load, Test&& test)
+        {
+            size_t wordCount = count / 64;
+            for (size_t word = 0; word < wordCount; ++word)
+            {
+                if (selection[word] == 0)
+                    continue;
+
+                uint64_t mask = 0;
+                V const* block = values + word * 64;
+                for (size_t lane = 0; lane < 64; lane += 4)
+                    mask |= uint64_t(_mm_movemask_ps(_mm_castsi128_ps(test(load(block + lane))))) << lane;
+
+                selection[word] &= mask;
+            }
+
+            return wordCount * 64;
+        }
+#endif
+    }
+
+    void FilterRange(uint32_t const* values, size_t count, uint32_t lower, uint32_t upper, uint64_t* selection)
+    {
+        size_t first = 0;
+
+#ifdef COLUMN_KERNELS_SSE2
+        // SSE2 only compares signed integers; flipping the sign bit maps unsigned order onto signed order.
+        __m128i bias = _mm_set1_epi32(int32_t(0x80000000u));
+        __m128i lowerBiased = _mm_xor_si128(_mm_set1_epi32(int32_t(lower)), bias);
+        __m128i upperBiased = _mm_xor_si128(_mm_set1_epi32(int32_t(upper)), bias);
+
+        first = FilterRangeWords(values, count, selection,
+            [bias](uint32_t const* block) { return _mm_xor_si128(_mm_loadu_si128(reinterpret_cast<__m128i const*>(block)), bias); },
+            [lowerBiased, upperBiased](__m128i value) {
+                __m128i outside = _mm_or_si128(_mm_cmplt_epi32(value, lowerBiased), _mm_cmpgt_epi32(value, upperBiased));
+                return _mm_xor_si128(outside, _mm_set1_epi32(-1));
+            });
+#endif
+
+        FilterRangeScalar(values, first, count, lower, upper, selection);
+    }
+
+    void FilterRange(int32_t const* values, size_t count, int32_t lower, int32_t upper, uint64_t* selection)
+    {
+        size_t first = 0;
+
+#ifdef COLUMN_KERNELS_SSE2
+        __m128i lowerBound = _mm_set1_epi32(lower);
+        __m128i upperBound = _mm_set1_epi32(upper);
+
+        first = FilterRangeWords(values, count, selection,
+            [](int32_t const* block) { return _mm_loadu_si128(reinterpret_cast<__m128i const*>(block)); },
+            [lowerBound, upperBound](__m128i value) {
+                __m128i outside = _mm_or_si128(_mm_cmplt_epi32(value, lowerBound), _mm_cmpgt_epi32(value, upperBound));
+                return _mm_xor_si128(outside, _mm_set1_epi32(-1));
+            });
+#endif
+
+        FilterRangeScalar(values, first, count, lower, upper, selection);
+    }
+
+    void FilterRange(float const* values, size_t count, float lower, float upper, uint64_t* selection)
+    {
+        size_t first = 0;
+
+#ifdef COLUMN_KERNELS_SSE2
+        __m128 lowerBound = _mm_set1_ps(lower);
+        __m128 upperBound = _mm_set1_ps(upper);
+
+        // NaN fails both ordered comparisons, exactly like the scalar path rejects it.
+        first = FilterRangeWords(values, count, selection,
+            [](float const* block) { return _mm_loadu_ps(block); },
+            [lowerBound, upperBound](__m128 value) {
+                return _mm_castps_si128(_mm_and_ps(_mm_cmpge_ps(value, lowerBound), _mm_cmple_ps(value, upperBound)));
+            });
+#endif
+
+        for (size_t i = first; i < count; ++i)
+        {
+            if (!(values[i] >= lower && values[i] <= upper))
+                selection[i / 64] &= ~(uint64_t(1) << (i % 64));
+        }
+    }
+
+    size_t CountSelected(uint64_t const* selection, size_t count)
+    {
+        size_t total = 0;
+        for (size_t word = 0; word < count / 64; ++word)
+            total += std::bitset<64>(selection[word]).count();
+
+        if (count % 64 != 0)
+            total += std::bitset<64>(selection[count / 64] & ((uint64_t(1) << (count % 64)) - 1)).count();
+
+        return total;
+    }
+}
@@ -0,0 +1,44 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#if defined(_MSC_VER)
+# include <intrin.h>
+#endif
+
+namespace wowgm::game::datastores::kernels
+{
+    /**
+     * Range predicates over one column. Bit i of {@param selection} is cleared unless values[i] lies in
+     * [{@param lower}, {@param upper}]; bits that are already clear stay clear, so successive filters AND together.
+     *
+     * {@param selection} holds one bit per value, packed into 64-bit words, and must cover {@param count} values.
+     */
+    void FilterRange(uint32_t const* values, size_t count, uint32_t lower, uint32_t upper, uint64_t* selection);
+    void FilterRange(int32_t const* values, size_t count, int32_t lower, int32_t upper, uint64_t* selection);
+    void FilterRange(float const* values, size_t count, float lower, float upper, uint64_t* selection);
+
+    /// Number of set bits among the first {@param count} bits of {@param selection}.
+    size_t CountSelected(uint64_t const* selection, size_t count);
+
+    /// Index of the lowest set bit of {@param word}, which must not be zero.
+    inline uint32_t LowestSetBit(uint64_t word)
+    {
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_ARM64))
+        unsigned long index;
+        _BitScanForward64(&index, word);
+        return uint32_t(index);
+#elif defined(_MSC_VER)
+        // 32-bit targets only scan 32 bits at a time.
+        unsigned long index;
+        if (_BitScanForward(&index, uint32_t(word)))
+            return uint32_t(index);
+
+        _BitScanForward(&index, uint32_t(word >> 32));
+        return uint32_t(index) + 32u;
+#else
+        return uint32_t(__builtin_ctzll(word));
+#endif
+    }
+}
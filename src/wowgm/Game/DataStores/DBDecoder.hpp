@@ -0,0 +1,159 @@
+#pragma once
+
+#include "DBLayout.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <utility>
+
+namespace wowgm::game::datastores
+{
+    namespace detail
+    {
+        /// True if field {@param j} is copied and directly follows the previous copied field, in the file as in memory.
+        template <typename Meta>
+        constexpr bool extends_copy_run(uint32_t j)
+        {
+            return j > 0
+                && encoding_of<Meta>(j) == field_encoding::copy
+                && encoding_of<Meta>(j - 1) == field_encoding::copy
+                && Meta::field_offsets[j - 1] + Meta::field_sizes[j - 1] == Meta::field_offsets[j];
+        }
+
+        /// Bytes covered by the run of copied fields starting at field {@param j}.
+        template <typename Meta>
+        constexpr uint32_t copy_run_size(uint32_t j)
+        {
+            uint32_t size = Meta::field_sizes[j];
+            for (uint32_t k = j + 1; k < Meta::field_count && extends_copy_run<Meta>(k); ++k)
+                size += Meta::field_sizes[k];
+            return size;
+        }
+
+        /// True if decoding a block of records is a single copy of the block.
+        template <typename Meta>
+        constexpr bool is_block_copyable()
+        {
+            return Meta::field_count > 0
+                && Meta::field_offsets[0] == 0
+                && encoding_of<Meta>(0) == field_encoding::copy
+                && copy_run_size<Meta>(0) == Meta::record_size
+                && decoded_record_size<Meta>() == Meta::record_size;
+        }
+
+        /**
+         * Decodes raw records of the table described by {@param Meta}. Every field is expanded at compile time
+         * into straight-line code; adjacent fields that keep their width collapse into one memcpy.
+         */
+        template <typename Meta>
+        struct record_decoder
+        {
+            /// Decodes the raw record at {@param data} into {@param record}. Strings point into {@param strings}.
+            static void Decode(uint8_t* record, uint8_t const* data, uint8_t const* strings)
+            {
+                DecodeFields(record, data, strings, std::make_index_sequence<Meta::field_count>());
+            }
+
+            /// Decodes {@param recordCount} consecutive raw records into records {@param stride} bytes apart.
+            static void DecodeBlock(uint8_t* records, size_t stride, uint8_t const* data, uint32_t recordCount, uint8_t const* strings)
+            {
+                if constexpr (is_block_copyable<Meta>())
+                {
+                    if (stride == Meta::record_size)
+                    {
+                        memcpy(records, data, size_t(recordCount) * Meta::record_size);
+                        return;
+                    }
+                }
+
+                for (uint32_t i = 0; i < recordCount; ++i)
+                    Decode(records + i * stride, data + size_t(i) * Meta::record_size, strings);
+            }
+
+        private:
+            template <size_t... J>
+            static void DecodeFields(uint8_t* record, uint8_t const* data, uint8_t const* strings, std::index_sequence<J...>)
+            {
+                (DecodeField<uint32_t(J)>(record, data, strings), ...);
+            }
+
+            template <uint32_t J>
+            static void DecodeField(uint8_t* record, uint8_t const* data, uint8_t const* strings)
+            {
+                constexpr uint32_t source = Meta::field_offsets[J];
+                constexpr uint32_t target = decoded_field_offset<Meta>(J);
+                constexpr field_encoding encoding = encoding_of<Meta>(J);
+
+                if constexpr (encoding == field_encoding::string)
+                {
+                    for (uint32_t k = 0; k < Meta::field_sizes[J] / 4u; ++k)
+                    {
+                        uint32_t stringOffset;
+                        memcpy(&stringOffset, data + source + 4u * k, sizeof(uint32_t));
+
+                        uintptr_t stringValue = reinterpret_cast<uintptr_t>(strings + stringOffset);
+                        memcpy(record + target + k * sizeof(uintptr_t), &stringValue, sizeof(uintptr_t));
+                    }
+                }
+                else if constexpr (encoding == field_encoding::widen)
+                {
+                    for (uint32_t k = 0; k < widened_item_count<Meta>(J); ++k)
+                    {
+                        constexpr uint32_t size = Meta::field_sizes[J];
+                        uint32_t itemSize = size - 4u * k < 4u ? size - 4u * k : 4u;
+
+                        uint32_t value = 0;
+                        memcpy(&value, data + source + 4u * k, itemSize);
+                        memcpy(record + target + 4u * k, &value, sizeof(uint32_t));
+                    }
+                }
+                else if constexpr (!extends_copy_run<Meta>(J))
+                {
+                    memcpy(record + target, data + source, copy_run_size<Meta>(J));
+                }
+            }
+        };
+
+        /**
+         * Field-by-field decoder that walks the meta at runtime, as tables were decoded before {@link record_decoder}.
+         * Produces the same records; only kept as a baseline for load benchmarks.
+         */
+        template <typename Meta>
+        void decode_record_generic(uint8_t* record, uint8_t const* data, uint8_t const* strings)
+        {
+            for (uint32_t j = 0; j < Meta::field_count; ++j)
+            {
+                uint8_t* target = record + decoded_field_offset<Meta>(j);
+                uint8_t const* source = data + Meta::field_offsets[j];
+
+                switch (encoding_of<Meta>(j))
+                {
+                    case field_encoding::string:
+                        for (uint32_t k = 0; k < Meta::field_sizes[j] / 4u; ++k)
+                        {
+                            uint32_t stringOffset;
+                            memcpy(&stringOffset, source + 4u * k, sizeof(uint32_t));
+
+                            uintptr_t stringValue = reinterpret_cast<uintptr_t>(strings + stringOffset);
+                            memcpy(target + k * sizeof(uintptr_t), &stringValue, sizeof(uintptr_t));
+                        }
+                        break;
+                    case field_encoding::widen:
+                        for (uint32_t k = 0; k < widened_item_count<Meta>(j); ++k)
+                        {
+                            uint32_t itemSize = Meta::field_sizes[j] - 4u * k < 4u ? Meta::field_sizes[j] - 4u * k : 4u;
+
+                            uint32_t value = 0;
+                            memcpy(&value, source + 4u * k, itemSize);
+                            memcpy(target + 4u * k, &value, sizeof(uint32_t));
+                        }
+                        break;
+                    default:
+                        memcpy(target, source, Meta::field_sizes[j]);
+                        break;
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,194 @@
+#pragma once
+
+#include "DBCStructures.hpp"
+#include "DBTraits.hpp"
+#include "DBLayout.hpp"
+#include "DBColumns.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <extstd/containers/flat_hash_map.hpp>
+
+namespace wowgm::game::datastores
+{
+    /// Contiguous run of records returned by non-unique index lookups.
+    template <typename T>
+    struct RecordRange
+    {
+        T const* const* First = nullptr;
+        T const* const* Last = nullptr;
+
+        T const* const* begin() const { return First; }
+        T const* const* end() const { return Last; }
+
+        size_t size() const { return size_t(Last - First); }
+        bool empty() const { return First == Last; }
+    };
+
+    /// Maps each value of a column to the one record holding it. Later records win on duplicates, like primary IDs.
+    template <typename T, uint32_t Column>
+    class UniqueIndex
+    {
+    public:
+        using column = column_traits<T, Column>;
+        using key_type = typename column::value_type;
+
+        void Build(T const* records, uint32_t recordCount)
+        {
+            _records.clear();
+            _records.reserve(recordCount);
+
+            for (uint32_t i = 0; i < recordCount; ++i)
+                _records[column::Read(records[i])] = &records[i];
+        }
+
+        /// Returns nullptr if no record holds that value.
+        T const* Find(key_type key) const
+        {
+            auto itr = _records.find(key);
+            return itr != _records.end() ? itr->second : nullptr;
+        }
+
+    private:
+        extstd::containers::flat_hash_map<key_type, T const*> _records;
+    };
+
+    /// Groups records by the value of a column, for 1:N relations such as children pointing at their parent.
+    template <typename T, uint32_t Column>
+    class MultiIndex
+    {
+    public:
+        using column = column_traits<T, Column>;
+        using key_type = typename column::value_type;
+
+        void Build(T const* records, uint32_t recordCount)
+        {
+            _groups.clear();
+            _records.assign(recordCount, nullptr);
+
+            // Count, then lay every group out contiguously in file order.
+            for (uint32_t i = 0; i < recordCount; ++i)
+                ++_groups[column::Read(records[i])].second;
+
+            uint32_t offset = 0;
+            for (auto&& group : _groups)
+            {
+                group.second.first = offset;
+                offset += group.second.second;
+                group.second.second = 0;
+            }
+
+            for (uint32_t i = 0; i < recordCount; ++i)
+            {
+                auto& group = _groups[column::Read(records[i])];
+                _records[group.first + group.second++] = &records[i];
+            }
+        }
+
+        RecordRange<T> Find(key_type key) const
+        {
+            auto itr = _groups.find(key);
+            if (itr == _groups.end())
+                return { };
+
+            T const* const* first = _records.data() + itr->second.first;
+            return { first, first + itr->second.second };
+        }
+
+    private:
+        extstd::containers::flat_hash_map<key_type, std::pair<uint32_t, uint32_t>> _groups;
+        std::vector<T const*> _records;
+    };
+
+    /// Orders records by the value of a column; ties keep file order.
+    template <typename T, uint32_t Column>
+    class RangeIndex
+    {
+    public:
+        using column = column_traits<T, Column>;
+        using key_type = typename column::value_type;
+
+        void Build(T const* records, uint32_t recordCount)
+        {
+            std::vector<std::pair<key_type, T const*>> entries;
+            entries.reserve(recordCount);
+            for (uint32_t i = 0; i < recordCount; ++i)
+                entries.emplace_back(column::Read(records[i]), &records[i]);
+
+            std::stable_sort(entries.begin(), entries.end(), [](auto const& left, auto const& right) {
+                return left.first < right.first;
+            });
+
+            _keys.resize(recordCount);
+            _records.resize(recordCount);
+            for (uint32_t i = 0; i < recordCount; ++i)
+                std::tie(_keys[i], _records[i]) = entries[i];
+        }
+
+        /// Records whose value lies in [{@param lower}, {@param upper}].
+        RecordRange<T> Range(key_type lower, key_type upper) const
+        {
+            size_t first = std::lower_bound(_keys.begin(), _keys.end(), lower) - _keys.begin();
+            size_t last = std::upper_bound(_keys.begin(), _keys.end(), upper) - _keys.begin();
+            if (last < first)
+                last = first;
+
+            return { _records.data() + first, _records.data() + last };
+        }
+
+        RecordRange<T> Find(key_type key) const { return Range(key, key); }
+
+    private:
+        std::vector<key_type> _keys;
+        std::vector<T const*> _records;
+    };
+
+    /// Secondary indexes and column stores built alongside a table, as a std::tuple. None by default.
+    template <typename T> struct secondary_indexes {
+        using type = std::tuple<>;
+    };
+
+    // Declarations below name their column by its position in the table's meta, and check it against the member.
+
+    using MapByDirectory = UniqueIndex<MapEntry, 1>;
+    static_assert(MapByDirectory::column::offset == offsetof(MapEntry, Directory), "");
+
+    template <> struct secondary_indexes<MapEntry> {
+        using type = std::tuple<MapByDirectory>;
+    };
+
+    using ItemSparseByLevel = RangeIndex<ItemSparseEntry, 11>;
+    static_assert(ItemSparseByLevel::column::offset == offsetof(ItemSparseEntry, ItemLevel), "");
+
+    using ItemSparseByName = MultiIndex<ItemSparseEntry, 38>;
+    static_assert(ItemSparseByName::column::offset == offsetof(ItemSparseEntry, Name), "");
+
+    using ItemSparseColumns = ColumnStore<ItemSparseEntry, 1, 8, 11>;
+    static_assert(ItemSparseColumns::column<1>::offset == offsetof(ItemSparseEntry, Quality), "");
+    static_assert(ItemSparseColumns::column<8>::offset == offsetof(ItemSparseEntry, InventoryType), "");
+    static_assert(ItemSparseColumns::column<11>::offset == offsetof(ItemSparseEntry, ItemLevel), "");
+
+    template <> struct secondary_indexes<ItemSparseEntry> {
+        using type = std::tuple<ItemSparseByLevel, ItemSparseByName, ItemSparseColumns>;
+    };
+
+    using SpellByName = MultiIndex<SpellEntry, 20>;
+    static_assert(SpellByName::column::offset == offsetof(SpellEntry, Name), "");
+
+    template <> struct secondary_indexes<SpellEntry> {
+        using type = std::tuple<SpellByName>;
+    };
+
+    using CreatureDisplayInfoByModel = MultiIndex<CreatureDisplayInfoEntry, 1>;
+    static_assert(CreatureDisplayInfoByModel::column::offset == offsetof(CreatureDisplayInfoEntry, ModelID), "");
+
+    template <> struct secondary_indexes<CreatureDisplayInfoEntry> {
+        using type = std::tuple<CreatureDisplayInfoByModel>;
+    };
+}
@@ -0,0 +1,181 @@
+#pragma once
+
+#include "DBTraits.hpp"
+
+#include <cstdint>
+#include <cstddef>
+#include <cstring>
+#include <string_view>
+#include <type_traits>
+
+namespace wowgm::game::datastores
+{
+    namespace detail
+    {
+        /**
+         * Returns true if records decoded by {@link record_decoder} would be byte-for-byte identical to their
+         * file representation - every field is packed back to back at its file offset and keeps its file width.
+         * String offsets only qualify where they can be relocated in place into pointers, i.e. on 32-bit targets.
+         */
+        template <typename Meta, typename T>
+        constexpr bool is_layout_compatible()
+        {
+            if (sizeof(T) != Meta::record_size)
+                return false;
+
+            uint32_t offset = 0;
+            for (uint32_t j = 0; j < Meta::field_count; ++j)
+            {
+                if (Meta::field_offsets[j] != offset)
+                    return false;
+
+                switch (Meta::field_types[j])
+                {
+                    case 's':
+                        if (sizeof(uintptr_t) != sizeof(uint32_t))
+                            return false;
+                        break;
+                    case 'l':
+                        if (Meta::field_sizes[j] < 8u)
+                            return false;
+                        break;
+                    case 'b':
+                        break;
+                    default:
+                        if (Meta::field_sizes[j] % 4u != 0)
+                            return false;
+                        break;
+                }
+
+                offset += Meta::field_sizes[j];
+            }
+
+            return offset == Meta::record_size;
+        }
+
+        /// How {@link record_decoder} turns a field of the file into a member of the decoded record.
+        enum class field_encoding
+        {
+            /// Copied as is.
+            copy,
+            /// Packed integers narrower than their 4-byte members, zero-extended one member at a time.
+            widen,
+            /// String block offsets, relocated into pointers.
+            string
+        };
+
+        template <typename Meta>
+        constexpr field_encoding encoding_of(uint32_t j)
+        {
+            switch (Meta::field_types[j])
+            {
+                case 's':
+                    return field_encoding::string;
+                case 'l':
+                case 'b':
+                    return field_encoding::copy;
+                default:
+                    return Meta::field_sizes[j] % 4u != 0 ? field_encoding::widen : field_encoding::copy;
+            }
+        }
+
+        /// Number of 4-byte members a packed field widens to; the generated structures never go below one.
+        template <typename Meta>
+        constexpr uint32_t widened_item_count(uint32_t j)
+        {
+            return Meta::field_sizes[j] < 4u ? 1u : Meta::field_sizes[j] / 4u;
+        }
+
+        /// Size of field {@param j} once decoded by {@link record_decoder}.
+        template <typename Meta>
+        constexpr uint32_t decoded_field_size(uint32_t j)
+        {
+            switch (encoding_of<Meta>(j))
+            {
+                case field_encoding::string:
+                    return Meta::field_sizes[j] / 4u * uint32_t(sizeof(uintptr_t));
+                case field_encoding::widen:
+                    return widened_item_count<Meta>(j) * 4u;
+                default:
+                    return Meta::field_sizes[j];
+            }
+        }
+
+        /// Offset of field {@param column} in decoded records.
+        template <typename Meta>
+        constexpr uint32_t decoded_field_offset(uint32_t column)
+        {
+            uint32_t offset = 0;
+            for (uint32_t j = 0; j < column; ++j)
+                offset += decoded_field_size<Meta>(j);
+            return offset;
+        }
+
+        template <typename Meta>
+        constexpr uint32_t decoded_record_size()
+        {
+            return decoded_field_offset<Meta>(Meta::field_count);
+        }
+
+        /// Fingerprints everything decoding depends on, so that snapshots die with the meta they were built from.
+        template <typename Meta, typename T>
+        constexpr uint64_t layout_hash()
+        {
+            uint64_t hash = 0xCBF29CE484222325uLL;
+            auto combine = [&hash](uint64_t value) {
+                for (uint32_t i = 0; i < 8; ++i)
+                    hash = (hash ^ ((value >> (i * 8)) & 0xFF)) * 0x100000001B3uLL;
+            };
+
+            combine(sizeof(T));
+            combine(sizeof(uintptr_t));
+            combine(Meta::record_size);
+            combine(Meta::index_column);
+            combine(Meta::sparse_storage);
+            for (uint32_t j = 0; j < Meta::field_count; ++j)
+            {
+                combine(uint64_t(uint8_t(Meta::field_types[j])));
+                combine(Meta::field_offsets[j]);
+                combine(Meta::field_sizes[j]);
+            }
+
+            return hash;
+        }
+    }
+
+    /**
+     * Reads column {@param Column} of decoded records of {@param T}. Columns are numbered like the fields of the
+     * table's generated meta; array fields can't be indexed.
+     */
+    template <typename T, uint32_t Column>
+    struct column_traits
+    {
+        using meta_t = typename meta_type<T>::type;
+        static_assert(Column < meta_t::field_count, "Column out of range.");
+
+        constexpr static const char type = meta_t::field_types[Column];
+        constexpr static const uint32_t offset = detail::decoded_field_offset<meta_t>(Column);
+
+        static_assert(detail::decoded_field_size<meta_t>(Column) == (type == 's' ? sizeof(uintptr_t) : type == 'l' ? 8u : type == 'b' ? 1u : 4u),
+            "Array fields can't be indexed.");
+
+        using storage_type = std::conditional_t<type == 's', const char*,
+            std::conditional_t<type == 'f', float,
+            std::conditional_t<type == 'l', uint64_t,
+            std::conditional_t<type == 'b', uint8_t,
+            std::conditional_t<type == 'i', int32_t, uint32_t>>>>>;
+
+        using value_type = std::conditional_t<type == 's', std::string_view, storage_type>;
+
+        static value_type Read(T const& record)
+        {
+            storage_type value;
+            memcpy(&value, reinterpret_cast<uint8_t const*>(&record) + offset, sizeof(storage_type));
+
+            if constexpr (type == 's')
+                return value != nullptr ? std::string_view(value) : std::string_view();
+            else
+                return value;
+        }
+    };
+}
@@ -0,0 +1,247 @@
+#pragma once
+
+#include "DBStorage.hpp"
+#include "ForeignKey.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <future>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace wowgm::game::datastores
+{
+    namespace detail
+    {
+        template <typename T>
+        T const& dereference(T const& record) { return record; }
+
+        template <typename T>
+        T const& dereference(T const* record) { return *record; }
+
+        /// The right-most record of a value produced by {@link Query::Join}, or the value itself.
+        template <typename V>
+        struct last_record
+        {
+            static V const& get(V const& value) { return value; }
+        };
+
+        template <typename L, typename R>
+        struct last_record<std::pair<L, R>>
+        {
+            static auto const& get(std::pair<L, R> const& value) { return last_record<std::decay_t<R>>::get(value.second); }
+        };
+
+        /// Values are gathered as is; references to records are gathered as pointers.
+        template <typename V>
+        using gathered_type = std::conditional_t<std::is_reference<V>::value, std::remove_reference_t<V> const*, V>;
+
+        template <typename V>
+        gathered_type<V> gather(V&& value)
+        {
+            if constexpr (std::is_reference<V>::value)
+                return &value;
+            else
+                return std::forward<V>(value);
+        }
+    }
+
+    /**
+     * Lazy pipeline over the records of a {@param Source} - a {@link RecordSpan} or a {@link RecordRange}.
+     *
+     * Adaptors build a new query and run nothing; the terminal calls walk the source once, pushing every record
+     * through the stages. Records start out as {@code T const&}; {@link Select} turns them into anything,
+     * and {@link Join} pairs them with the target of one of their foreign keys.
+     *
+     * Parallel terminals split the source in contiguous chunks, so their callables must be thread-safe. Gathered
+     * values keep source order either way.
+     */
+    template <typename Source, typename Value, typename Stage>
+    class Query
+    {
+        /// Records per parallel task, below which splitting costs more than it saves.
+        constexpr static const size_t ParallelGrain = 4096;
+
+    public:
+        using value_type = Value;
+        using record_type = std::remove_cv_t<std::remove_reference_t<decltype(detail::dereference(*std::declval<Source const&>().begin()))>>;
+
+        Query(Source source, Stage stage) : _source(source), _stage(std::move(stage)) { }
+
+        /// Keeps values for which {@param predicate} returns true.
+        template <typename Predicate>
+        auto Where(Predicate predicate) const
+        {
+            auto stage = [previous = _stage, predicate](record_type const& record, auto&& emit) {
+                previous(record, [&](Value value) {
+                    if (predicate(static_cast<Value>(value)))
+                        emit(static_cast<Value>(value));
+                });
+            };
+
+            return Query<Source, Value, decltype(stage)>(_source, std::move(stage));
+        }
+
+        /// Replaces values by what {@param selector} returns for them.
+        template <typename Selector>
+        auto Select(Selector selector) const
+        {
+            using Result = std::invoke_result_t<Selector, Value>;
+
+            auto stage = [previous = _stage, selector](record_type const& record, auto&& emit) {
+                previous(record, [&](Value value) {
+                    emit(static_cast<Result>(selector(static_cast<Value>(value))));
+                });
+            };
+
+            return Query<Source, Result, decltype(stage)>(_source, std::move(stage));
+        }
+
+        /**
+         * Pairs values with the record their right-most record points to through {@param member}. Values whose
+         * key doesn't resolve are dropped, like an inner join. Joins chain: each one follows the last record joined.
+         */
+        template <typename Record, typename Target>
+        auto Join(structures::ForeignKey<Target> Record::* member) const
+        {
+            static_assert(std::is_same<std::decay_t<decltype(detail::last_record<std::decay_t<Value>>::get(std::declval<Value>()))>, Record>::value,
+                "Joins follow a foreign key of the last record joined.");
+
+            using Result = std::pair<Value, Target const&>;
+
+            auto stage = [previous = _stage, member](record_type const& record, auto&& emit) {
+                previous(record, [&](Value value) {
+                    Record const& left = detail::last_record<std::decay_t<Value>>::get(value);
+                    if (Target const* right = (left.*member).Resolve())
+                        emit(Result(static_cast<Value>(value), *right));
+                });
+            };
+
+            return Query<Source, Result, decltype(stage)>(_source, std::move(stage));
+        }
+
+        template <typename F>
+        void ForEach(F&& f) const
+        {
+            for (auto&& element : _source)
+                _stage(detail::dereference(element), f);
+        }
+
+        template <typename F>
+        void ParallelForEach(F const& f) const
+        {
+            RunChunks([this, &f](auto first, auto last) {
+                for (auto itr = first; itr != last; ++itr)
+                    _stage(detail::dereference(*itr), f);
+                return 0;
+            });
+        }
+
+        size_t Count() const
+        {
+            size_t count = 0;
+            ForEach([&count](Value) { ++count; });
+            return count;
+        }
+
+        size_t ParallelCount() const
+        {
+            size_t count = 0;
+            for (size_t chunkCount : RunChunks([this](auto first, auto last) {
+                size_t chunkCount = 0;
+                for (auto itr = first; itr != last; ++itr)
+                    _stage(detail::dereference(*itr), [&chunkCount](Value) { ++chunkCount; });
+                return chunkCount;
+            }))
+                count += chunkCount;
+
+            return count;
+        }
+
+        std::vector<detail::gathered_type<Value>> ToVector() const
+        {
+            std::vector<detail::gathered_type<Value>> values;
+            ForEach([&values](Value value) { values.push_back(detail::gather<Value>(static_cast<Value>(value))); });
+            return values;
+        }
+
+        std::vector<detail::gathered_type<Value>> ParallelToVector() const
+        {
+            auto chunks = RunChunks([this](auto first, auto last) {
+                std::vector<detail::gathered_type<Value>> values;
+                for (auto itr = first; itr != last; ++itr)
+                    _stage(detail::dereference(*itr), [&values](Value value) { values.push_back(detail::gather<Value>(static_cast<Value>(value))); });
+                return values;
+            });
+
+            std::vector<detail::gathered_type<Value>> values;
+            for (auto& chunk : chunks)
+                values.insert(values.end(), chunk.begin(), chunk.end());
+            return values;
+        }
+
+    private:
+        /// Runs {@param task} over contiguous chunks of the source and returns its results in source order.
+        template <typename Task>
+        auto RunChunks(Task&& task) const
+        {
+            using Result = decltype(task(_source.begin(), _source.end()));
+
+            size_t elementCount = size_t(_source.end() - _source.begin());
+            size_t taskCount = std::min<size_t>(std::max(1u, std::thread::hardware_concurrency()), (elementCount + ParallelGrain - 1) / ParallelGrain);
+
+            std::vector<Result> results;
+            if (taskCount <= 1)
+            {
+                results.push_back(task(_source.begin(), _source.end()));
+                return results;
+            }
+
+            std::vector<std::future<Result>> pending;
+            pending.reserve(taskCount);
+            for (size_t i = 0; i < taskCount; ++i)
+            {
+                auto first = _source.begin() + elementCount * i / taskCount;
+                auto last = _source.begin() + elementCount * (i + 1) / taskCount;
+                pending.push_back(std::async(std::launch::async, [&task, first, last]() { return task(first, last); }));
+            }
+
+            results.reserve(taskCount);
+            for (std::future<Result>& future : pending)
+                results.push_back(future.get());
+            return results;
+        }
+
+        Source _source;
+        Stage _stage;
+    };
+
+    namespace detail
+    {
+        template <typename Source>
+        auto make_query(Source source)
+        {
+            using record_type = std::remove_cv_t<std::remove_reference_t<decltype(dereference(*source.begin()))>>;
+
+            auto stage = [](record_type const& record, auto&& emit) { emit(record); };
+            return Query<Source, record_type const&, decltype(stage)>(source, std::move(stage));
+        }
+    }
+
+    /// Queries every record of {@param T}, loading the table on first use.
+    template <typename T>
+    auto From()
+    {
+        return detail::make_query(Storage<T>::GetRecords());
+    }
+
+    /// Queries the records of an index lookup or of any other span of records.
+    template <typename Source>
+    auto From(Source source)
+    {
+        return detail::make_query(source);
+    }
+}
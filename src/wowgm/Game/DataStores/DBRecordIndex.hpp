@@ -0,0 +1,87 @@
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <vector>
+
+#include <extstd/containers/flat_hash_map.hpp>
+
+namespace wowgm::game::datastores
+{
+    /**
+     * Maps record IDs to their slot in a table's record array.
+     *
+     * IDs in most tables are dense within [min, max], in which case the slot is found with one bounds check and
+     * one indexed load into a vector covering that range. Tables whose IDs are too spread out for that vector
+     * to be worth its memory fall back to a hashed lookup.
+     */
+    class RecordIndex final
+    {
+    public:
+        constexpr static const uint32_t npos = 0xFFFFFFFFu;
+
+        /**
+         * Prepares the index for {@param recordCount} records whose IDs lie in [{@param minID}, {@param maxID}].
+         * Every previously inserted ID is forgotten.
+         */
+        void Reset(uint32_t minID, uint32_t maxID, uint32_t recordCount)
+        {
+            _minID = minID;
+            _slots.clear();
+            _sparseSlots.clear();
+
+            if (recordCount == 0)
+            {
+                _dense = true;
+                return;
+            }
+
+            // A dense slot costs four bytes per ID in range; a hashed one is roughly three times that per record.
+            uint64_t span = uint64_t(maxID) - minID + 1;
+            _dense = span <= uint64_t(recordCount) * 3 + 64;
+
+            if (_dense)
+                _slots.assign(size_t(span), npos);
+            else
+                _sparseSlots.reserve(recordCount);
+        }
+
+        /// Later insertions of the same ID win, mirroring how the client resolves duplicated rows.
+        void Insert(uint32_t id, uint32_t slot)
+        {
+            if (_dense)
+                _slots[id - _minID] = slot;
+            else
+                _sparseSlots[id] = slot;
+        }
+
+        /// Returns {@link npos} if no record has that ID.
+        uint32_t Find(uint32_t id) const
+        {
+            if (_dense)
+            {
+                uint32_t offset = id - _minID;
+                return offset < _slots.size() ? _slots[offset] : npos;
+            }
+
+            auto itr = _sparseSlots.find(id);
+            return itr != _sparseSlots.end() ? itr->second : npos;
+        }
+
+        bool IsDense() const { return _dense; }
+
+        /// Bytes held by the index itself, excluding the records it points into.
+        size_t GetMemoryUsage() const
+        {
+            return _slots.capacity() * sizeof(uint32_t)
+                + _sparseSlots.capacity() * (sizeof(std::pair<const uint32_t, uint32_t>) + 1);
+        }
+
+    private:
+        bool _dense = true;
+        uint32_t _minID = 0;
+
+        std::vector<uint32_t> _slots;
+        extstd::containers::flat_hash_map<uint32_t, uint32_t> _sparseSlots;
+    };
+}
@@ -5,6 +5,17 @@
 #include "Profiler.hpp"
 
 #include <shared/filesystem/mpq_file_system.hpp>
+#include <shared/filesystem/disk_file_system.hpp>
+#include <shared/log/log.hpp>
+
+#include <extstd/containers/flat_hash_map.hpp>
+
+#include <boost/filesystem.hpp>
+
+#include <algorithm>
+#include <fstream>
+#include <future>
+#include <limits>
 
 // Fucking windows.
 #ifdef max
@@ -13,125 +24,529 @@
 
 namespace wowgm::game::datastores
 {
+    namespace
+    {
+        constexpr static const uint32_t SnapshotMagic = 'SBDW';
+        constexpr static const uint32_t SnapshotVersion = 4;
+    }
+
     template <typename T>
     void Storage<T>::Initialize()
     {
+        uint64_t snapshotKey = GetSnapshotKey();
+        if (snapshotKey != 0 && LoadSnapshot(snapshotKey))
+        {
+            BuildSecondaryIndexes();
+            return;
+        }
+
         std::string completeFilePath = "DBFilesClient\\";
         completeFilePath += meta_t::name();
 
-        auto fileHandle = mpq_file_system::Instance()->OpenFile(completeFilePath);
+        // Records are decoded out of the file once and the snapshot covers reloads, so keeping it cached would only waste memory.
+        auto fileHandle = mpq_file_system::Instance()->OpenFile(completeFilePath, mpq_cache_policy::bypass);
         if (fileHandle == nullptr)
             return;
 
+        ReadFile(fileHandle->ReleaseData());
+
+        BuildSecondaryIndexes();
+
+        if (snapshotKey != 0)
+            SaveSnapshot(snapshotKey);
+    }
+
+    template <typename T>
+    void Storage<T>::ReadFile(std::vector<uint8_t> fileData)
+    {
         PROFILE;
 
-        get_storage().clear();
-        memcpy(&get_header(), fileHandle->GetData(), sizeof(header_type));
+        memcpy(&get_header(), fileData.data(), sizeof(header_type));
 
         if (!meta_t::sparse_storage)
             BOOST_ASSERT_MSG_FMT(get_header().Magic == 'CBDW', "File %s is WDBC but meta marks it as sparse. Re-generate file metadata.", meta_t::name());
         else
             BOOST_ASSERT_MSG_FMT(get_header().Magic == '2BDW', "File %s is WDB2 but meta marks it as non-sparse. Re-generate file metadata.", meta_t::name());
 
-        uint8_t const* recordData = fileHandle->GetData() + sizeof(header_type);
+        size_t recordOffset = GetRecordOffset(get_header());
+        size_t stringTableOffset = recordOffset + get_header().RecordCount * get_header().RecordSize;
+
+        // Rows cloned from another row are listed in the copy table rather than stored; they alias their source.
+        get_copy_table().clear();
+        if constexpr (meta_t::sparse_storage)
+        {
+            size_t copyTableOffset = stringTableOffset + get_header().StringBlockSize;
+            size_t copyCount = get_header().CopyTableSize / sizeof(DB2CopyEntry);
+            if (copyCount != 0 && copyTableOffset + copyCount * sizeof(DB2CopyEntry) <= fileData.size())
+            {
+                get_copy_table().resize(copyCount);
+                memcpy(get_copy_table().data(), fileData.data() + copyTableOffset, copyCount * sizeof(DB2CopyEntry));
+            }
+        }
+
+        uint8_t const* indexBlock = nullptr;
+        if constexpr (is_mapped)
+        {
+            // MPQ entries are compressed, so the decompressed buffer is as close to a mapping as it gets; adopt it.
+            get_storage().clear();
+            get_storage().shrink_to_fit();
+
+            get_mapping() = std::move(fileData);
+            MapRecords(get_mapping().data() + recordOffset, get_mapping().data() + stringTableOffset);
+            indexBlock = get_mapping().data() + sizeof(header_type);
+        }
+        else
+        {
+            // sparse tables can be loaded just like non-sparse if they don't have strings
+            LoadRecords(fileData.data() + recordOffset, fileData.data() + stringTableOffset);
+            indexBlock = fileData.data() + sizeof(header_type);
+        }
+
+        InternStrings();
+
+        if (!BuildIndexFromBlock(indexBlock))
+            BuildIndex();
+    }
+
+    template <typename T>
+    void Storage<T>::LoadFromMemory(std::vector<uint8_t> fileData)
+    {
+        // Later calls to Load must not go looking for the file in the archives.
+        std::call_once(get_load_flag(), []() { });
+
+        ReadFile(std::move(fileData));
+        BuildSecondaryIndexes();
+
+        get_loaded().store(true, std::memory_order_release);
+    }
+
+    template <typename T>
+    size_t Storage<T>::GetRecordOffset(header_type const& header)
+    {
+        size_t recordOffset = sizeof(header_type);
+
+        // The index block holds a row index and a string length per ID in range. Files without one leave both bounds at zero.
         if constexpr (meta_t::sparse_storage)
-            recordData += (4 + 2) * (get_header().MaxIndex - get_header().MinIndex + 1);
-        uint8_t const* stringTableData = recordData + get_header().RecordCount * get_header().RecordSize;
+            if (header.MaxIndex != 0)
+                recordOffset += (sizeof(uint32_t) + sizeof(uint16_t)) * (size_t(header.MaxIndex) - header.MinIndex + 1);
 
-        get_string_table().assign(stringTableData, stringTableData + get_header().StringBlockSize);
+        return recordOffset;
+    }
+
+    template <typename T>
+    void Storage<T>::BuildSecondaryIndexes()
+    {
+        std::apply([](auto&... indexes) {
+            constexpr size_t indexCount = sizeof...(indexes);
+            if constexpr (indexCount == 1)
+                (indexes.Build(get_records(), get_header().RecordCount), ...);
+            else if constexpr (indexCount > 1)
+            {
+                // Indexes only read the records, so they can all be built at once.
+                std::vector<std::future<void>> pending;
+                pending.reserve(indexCount);
+                (pending.push_back(std::async(std::launch::async, [&indexes]() {
+                    indexes.Build(get_records(), get_header().RecordCount);
+                })), ...);
+
+                for (std::future<void>& future : pending)
+                    future.get();
+            }
+        }, get_secondary_indexes());
+    }
+
+    template <typename T>
+    uint64_t Storage<T>::GetSnapshotKey()
+    {
+        uint64_t contentStamp = mpq_file_system::Instance()->GetContentStamp();
+        if (contentStamp == 0)
+            return 0;
 
-        // sparse tables can be loaded just like non-sparse if they don't have strings
-        LoadRecords(recordData);
+        uint64_t layout = detail::layout_hash<meta_t, T>() ^ SnapshotVersion;
+        return extstd::containers::mix64(contentStamp ^ extstd::containers::mix64(layout)) | 1u;
+    }
+
+    template <typename T>
+    std::string Storage<T>::GetSnapshotPath()
+    {
+        std::string path = "Cache/DBFilesClient/";
+        path += meta_t::name();
+        path += ".snapshot";
+        return path;
+    }
+
+    template <typename T>
+    template <typename F>
+    void Storage<T>::ForEachString(uint8_t* record, F&& f)
+    {
+        if constexpr (meta_t::has_string)
+        {
+            for (uint32_t j = 0; j < meta_t::field_count; ++j)
+            {
+                if (meta_t::field_types[j] != 's')
+                    continue;
+
+                uint8_t* member = record + detail::decoded_field_offset<meta_t>(j);
+                for (uint32_t k = 0; k < meta_t::field_sizes[j] / 4u; ++k)
+                    f(member + k * sizeof(uintptr_t));
+            }
+        }
+    }
+
+    template <typename T>
+    bool Storage<T>::LoadSnapshot(uint64_t key)
+    {
+        disk_file_system* fileSystem = disk_file_system::Instance();
+
+        std::string snapshotPath = GetSnapshotPath();
+        if (!fileSystem->FileExists(snapshotPath))
+            return false;
+
+        auto fileHandle = fileSystem->OpenFile(snapshotPath);
+        if (fileHandle == nullptr || fileHandle->GetData() == nullptr || fileHandle->GetFileSize() < sizeof(DBSnapshotHeader))
+            return false;
+
+        DBSnapshotHeader snapshotHeader;
+        memcpy(&snapshotHeader, fileHandle->GetData(), sizeof(DBSnapshotHeader));
+
+        if (snapshotHeader.Magic != SnapshotMagic || snapshotHeader.Version != SnapshotVersion || snapshotHeader.Key != key)
+            return false;
+
+        if (snapshotHeader.RecordSize != sizeof(T))
+            return false;
+
+        size_t headerOffset = sizeof(DBSnapshotHeader);
+        size_t recordOffset = headerOffset + sizeof(header_type);
+        size_t stringPoolOffset = recordOffset + size_t(snapshotHeader.RecordCount) * sizeof(T);
+        size_t copyTableOffset = stringPoolOffset + snapshotHeader.StringPoolSize;
+        if (fileHandle->GetFileSize() != copyTableOffset + size_t(snapshotHeader.CopyCount) * sizeof(DB2CopyEntry))
+            return false;
+
+        PROFILE;
+
+        uint8_t const* data = fileHandle->GetData();
+        memcpy(&get_header(), data + headerOffset, sizeof(header_type));
+
+        get_mapping().clear();
+        get_mapping().shrink_to_fit();
+
+        get_storage().resize(snapshotHeader.RecordCount);
+        get_storage().shrink_to_fit();
+        if (snapshotHeader.RecordCount != 0)
+            memcpy(get_storage().data(), data + recordOffset, size_t(snapshotHeader.RecordCount) * sizeof(T));
+
+        // String members were saved as offsets into the snapshot's own string block.
+        uintptr_t stringBase = reinterpret_cast<uintptr_t>(data + stringPoolOffset);
+        for (T& record : get_storage())
+        {
+            ForEachString(reinterpret_cast<uint8_t*>(&record), [stringBase](uint8_t* member) {
+                uintptr_t value;
+                memcpy(&value, member, sizeof(uintptr_t));
+                value += stringBase;
+                memcpy(member, &value, sizeof(uintptr_t));
+            });
+        }
+
+        get_copy_table().resize(snapshotHeader.CopyCount);
+        if (snapshotHeader.CopyCount != 0)
+            memcpy(get_copy_table().data(), data + copyTableOffset, size_t(snapshotHeader.CopyCount) * sizeof(DB2CopyEntry));
+
+        get_records() = get_storage().data();
+        InternStrings();
+        BuildIndex();
+        return true;
+    }
+
+    template <typename T>
+    void Storage<T>::SaveSnapshot(uint64_t key)
+    {
+        if (get_records() == nullptr)
+            return;
+
+        DBSnapshotHeader snapshotHeader;
+        snapshotHeader.Magic = SnapshotMagic;
+        snapshotHeader.Version = SnapshotVersion;
+        snapshotHeader.Key = key;
+        snapshotHeader.RecordSize = sizeof(T);
+        snapshotHeader.RecordCount = get_header().RecordCount;
+        snapshotHeader.CopyCount = uint32_t(get_copy_table().size());
+
+        std::vector<uint8_t> records(size_t(snapshotHeader.RecordCount) * sizeof(T));
+        if (!records.empty())
+            memcpy(records.data(), get_records(), records.size());
+
+        // Strings live in the shared pool, where interned pointers are unique; gather the ones of this table into a block.
+        std::vector<char> strings(1, '\0');
+        extstd::containers::flat_hash_map<char const*, uintptr_t> stringOffsets;
+        for (size_t i = 0; i < snapshotHeader.RecordCount; ++i)
+        {
+            ForEachString(records.data() + i * sizeof(T), [&strings, &stringOffsets](uint8_t* member) {
+                char const* value;
+                memcpy(&value, member, sizeof(uintptr_t));
+
+                auto itr = stringOffsets.try_emplace(value, uintptr_t(strings.size()));
+                if (itr.second)
+                    strings.insert(strings.end(), value, value + strlen(value) + 1);
+
+                memcpy(member, &itr.first->second, sizeof(uintptr_t));
+            });
+        }
+
+        snapshotHeader.StringPoolSize = uint32_t(strings.size());
+
+        boost::filesystem::path snapshotPath(disk_file_system::Instance()->GetRootFolder());
+        snapshotPath /= GetSnapshotPath();
+
+        // Write next to the target and rename, so that an interrupted write never leaves a truncated snapshot behind.
+        boost::filesystem::path temporaryPath = snapshotPath;
+        temporaryPath += ".tmp";
+
+        boost::system::error_code error;
+        boost::filesystem::create_directories(snapshotPath.parent_path(), error);
+
+        {
+            std::ofstream stream(temporaryPath.string(), std::ios::binary | std::ios::trunc);
+            stream.write(reinterpret_cast<const char*>(&snapshotHeader), sizeof(DBSnapshotHeader));
+            stream.write(reinterpret_cast<const char*>(&get_header()), sizeof(header_type));
+            stream.write(reinterpret_cast<const char*>(records.data()), records.size());
+            stream.write(strings.data(), strings.size());
+            if (snapshotHeader.CopyCount != 0)
+                stream.write(reinterpret_cast<const char*>(get_copy_table().data()), get_copy_table().size() * sizeof(DB2CopyEntry));
+
+            if (!stream)
+            {
+                LOG_INFO("Unable to write snapshot for {}.", meta_t::name());
+                stream.close();
+                boost::filesystem::remove(temporaryPath, error);
+                return;
+            }
+        }
+
+        boost::filesystem::rename(temporaryPath, snapshotPath, error);
+        if (error)
+        {
+            LOG_INFO("Unable to write snapshot for {}: {}", meta_t::name(), error.message());
+            boost::filesystem::remove(temporaryPath, error);
+        }
+    }
+
+    template <typename T>
+    void Storage<T>::Load()
+    {
+        if (get_loaded().load(std::memory_order_acquire))
+            return;
+
+        std::call_once(get_load_flag(), []() {
+            Initialize();
+            get_loaded().store(true, std::memory_order_release);
+        });
+    }
+
+    template <typename T>
+    bool Storage<T>::IsLoaded()
+    {
+        return get_loaded().load(std::memory_order_acquire);
     }
 
     template <typename T>
     T* Storage<T>::GetRecord(uint32_t index)
     {
-        return &get_storage()[index];
+        Load();
+
+        uint32_t slot = get_index().Find(index);
+        return slot != RecordIndex::npos ? &get_records()[slot] : nullptr;
+    }
+
+    template <typename T>
+    RecordSpan<T> Storage<T>::GetRecords()
+    {
+        Load();
+
+        if (get_records() == nullptr)
+            return { };
+
+        return { get_records(), get_records() + get_header().RecordCount };
+    }
+
+    template <typename T>
+    uint32_t Storage<T>::GetRecordCount()
+    {
+        Load();
+
+        return get_records() != nullptr ? get_header().RecordCount : 0u;
     }
 
     template <typename T>
-    void Storage<T>::LoadRecords(uint8_t const* data)
+    uint32_t Storage<T>::GetRecordID(uint32_t slot)
     {
-        for (uint32_t i = 0; i < get_header().RecordCount; ++i)
-            CopyToMemory(i, data + i * meta_t::record_size);
+        uint32_t id;
+        memcpy(&id, reinterpret_cast<uint8_t const*>(get_records() + slot) + detail::decoded_field_offset<meta_t>(meta_t::index_column), sizeof(uint32_t));
+        return id;
     }
 
     template <typename T>
-    void Storage<T>::CopyToMemory(uint32_t index, uint8_t const* data)
+    void Storage<T>::BuildIndex()
     {
-        static_assert(alignof(T) == 1, "Structures passed to Storage<T, ...> must be aligned to 1 byte. Use #pragma pack(push, 1)!");
+        uint32_t recordCount = get_records() != nullptr ? get_header().RecordCount : 0u;
 
-        uint32_t memoryOffset = 0;
-        uint8_t* structure_ptr = reinterpret_cast<uint8_t*>(&get_storage()[*reinterpret_cast<uint32_t const*>(data)]); // fixme find indexof n
-        for (uint32_t j = 0; j < meta_t::field_count; ++j)
+        uint32_t minID = std::numeric_limits<uint32_t>::max();
+        uint32_t maxID = 0;
+        for (uint32_t i = 0; i < recordCount; ++i)
         {
-            uint8_t* memberTarget = structure_ptr + memoryOffset;
-            BOOST_ASSERT(reinterpret_cast<uintptr_t>(memberTarget) < reinterpret_cast<uintptr_t>(structure_ptr + sizeof(T)));
+            uint32_t id = GetRecordID(i);
+            minID = std::min(minID, id);
+            maxID = std::max(maxID, id);
+        }
 
-            auto array_size = meta_t::field_sizes[j];
-            auto memory_size_item = 4u;
-            switch (meta_t::field_types[j])
+        ResetIndex(minID, maxID);
+        for (uint32_t i = 0; i < recordCount; ++i)
+            get_index().Insert(GetRecordID(i), i);
+
+        InsertCopies();
+    }
+
+    template <typename T>
+    bool Storage<T>::BuildIndexFromBlock(uint8_t const* indexBlock)
+    {
+        if constexpr (meta_t::sparse_storage)
+        {
+            header_type const& header = get_header();
+            if (header.MaxIndex == 0 || header.MaxIndex < header.MinIndex || get_records() == nullptr)
+                return false;
+
+            uint32_t rowCount = header.MaxIndex - header.MinIndex + 1;
+            auto readRow = [indexBlock](uint32_t i) -> uint32_t {
+                uint32_t row;
+                memcpy(&row, indexBlock + i * sizeof(uint32_t), sizeof(uint32_t));
+                return row;
+            };
+
+            // Absent IDs map to row 0, which only the ID actually stored there may claim.
+            uint32_t firstID = header.RecordCount != 0 ? GetRecordID(0) : 0;
+            for (uint32_t i = 0; i < rowCount; ++i)
+                if (readRow(i) >= header.RecordCount)
+                    return false;
+
+            ResetIndex(header.MinIndex, header.MaxIndex);
+            for (uint32_t i = 0; i < rowCount; ++i)
             {
-                case 's':
-                case 'i':
-                case 'n':
-                case 'u':
-                case 'f':
-                    break;
-                case 'l':
-                    memory_size_item = 8u;
-                    break;
-                case 'b':
-                    memory_size_item = 1u;
-                    break;
+                uint32_t row = readRow(i);
+                if (row != 0 || header.MinIndex + i == firstID)
+                    get_index().Insert(header.MinIndex + i, row);
             }
 
-            array_size /= memory_size_item;
+            InsertCopies();
+            return true;
+        }
+        else
+            return false;
+    }
+
+    template <typename T>
+    void Storage<T>::ResetIndex(uint32_t minID, uint32_t maxID)
+    {
+        uint32_t recordCount = get_records() != nullptr ? get_header().RecordCount : 0u;
+        if (recordCount == 0)
+        {
+            get_index().Reset(0, 0, 0);
+            return;
+        }
+
+        for (DB2CopyEntry const& copy : get_copy_table())
+        {
+            minID = std::min(minID, copy.NewID);
+            maxID = std::max(maxID, copy.NewID);
+        }
+
+        get_index().Reset(minID, maxID, recordCount + uint32_t(get_copy_table().size()));
+    }
+
+    template <typename T>
+    void Storage<T>::InsertCopies()
+    {
+        for (DB2CopyEntry const& copy : get_copy_table())
+        {
+            uint32_t slot = get_index().Find(copy.SourceID);
+            if (slot != RecordIndex::npos)
+                get_index().Insert(copy.NewID, slot);
+        }
+    }
+
+    template <typename T>
+    void Storage<T>::LoadRecords(uint8_t const* data, uint8_t const* stringTable)
+    {
+        uint32_t recordCount = get_header().RecordCount;
+
+        get_storage().assign(recordCount, T{});
+        get_storage().shrink_to_fit();
 
-            if (meta_t::field_types[j] == 's')
+        detail::record_decoder<meta_t>::DecodeBlock(reinterpret_cast<uint8_t*>(get_storage().data()), sizeof(T),
+            data, recordCount, stringTable);
+
+        get_records() = get_storage().data();
+    }
+
+    template <typename T>
+    void Storage<T>::InternStrings()
+    {
+        if constexpr (meta_t::has_string)
+        {
+            StringPool* stringPool = sStringPool;
+            for (uint32_t i = 0; i < get_header().RecordCount; ++i)
             {
-                for (uint32_t i = 0; i < array_size; ++i)
-                {
-                    if constexpr (true) // (!meta_t::sparse_storage) // WDB2 still has a string table
-                    {
-                        auto stringTableOffset = *reinterpret_cast<uint32_t const*>(data + meta_t::field_offsets[j] + 4u * i);
-                        const char* stringValue = reinterpret_cast<const char*>(&get_string_table()[stringTableOffset]);
-                        *reinterpret_cast<uintptr_t*>(memberTarget) = reinterpret_cast<uintptr_t>(stringValue);
-                    }
-                    else
-                    {
-                        uint8_t const* recordMember = data + meta_t::field_offsets[j] + 4u * i;
-                        size_t stringLength = strlen(reinterpret_cast<const char*>(recordMember));
-                        auto itr = &*get_string_table().insert(get_string_table().end(), recordMember, recordMember + stringLength);
-                        *reinterpret_cast<uintptr_t*>(memberTarget) = *reinterpret_cast<uintptr_t*>(*itr);
-                    }
+                ForEachString(reinterpret_cast<uint8_t*>(get_records() + i), [stringPool](uint8_t* member) {
+                    char const* value;
+                    memcpy(&value, member, sizeof(uintptr_t));
 
-                    memoryOffset += sizeof(uintptr_t); // // Advance to the next member ...
-                    memberTarget += sizeof(uintptr_t); // ... But also advance our own pointer in case we are an array.
-                }
+                    value = stringPool->GetCString(stringPool->Intern(value != nullptr ? std::string_view(value) : std::string_view()));
+                    memcpy(member, &value, sizeof(uintptr_t));
+                });
             }
-            else
+        }
+    }
+
+    template <typename T>
+    void Storage<T>::MapRecords(uint8_t* data, uint8_t const* stringTable)
+    {
+        if constexpr (meta_t::has_string)
+        {
+            for (uint32_t i = 0; i < get_header().RecordCount; ++i)
             {
-                if (memory_size_item > meta_t::field_sizes[j])
+                uint8_t* record = data + i * meta_t::record_size;
+                for (uint32_t j = 0; j < meta_t::field_count; ++j)
                 {
-                    for (uint32_t i = 0; i < array_size; ++i)
+                    if (meta_t::field_types[j] != 's')
+                        continue;
+
+                    for (uint32_t k = 0; k < meta_t::field_sizes[j] / 4u; ++k)
                     {
-                        memcpy(memberTarget, data + meta_t::field_offsets[j] + i * memory_size_item, memory_size_item);
-                        constexpr static const uint32_t masks[] = { 0x000000FFu, 0x0000FFFFu, 0x00FFFFFFu, 0xFFFFFFFFu };
-                        *reinterpret_cast<uint32_t*>(memberTarget) &= masks[meta_t::field_sizes[j] - 1];
+                        uint8_t* member = record + meta_t::field_offsets[j] + 4u * k;
 
-                        memoryOffset += memory_size_item;
-                        memberTarget += memory_size_item;
+                        uint32_t stringTableOffset;
+                        memcpy(&stringTableOffset, member, sizeof(uint32_t));
+
+                        uintptr_t stringValue = reinterpret_cast<uintptr_t>(stringTable + stringTableOffset);
+                        memcpy(member, &stringValue, sizeof(uintptr_t));
                     }
                 }
-                else
-                {
-                    memcpy(memberTarget, data + meta_t::field_offsets[j], meta_t::field_sizes[j]);
-                    memoryOffset += meta_t::field_sizes[j];
-                }
             }
         }
+
+        get_records() = reinterpret_cast<T*>(data);
+    }
+
+    template <typename T>
+    std::once_flag& Storage<T>::get_load_flag()
+    {
+        static std::once_flag _loadFlag;
+        return _loadFlag;
+    }
+
+    template <typename T>
+    std::atomic<bool>& Storage<T>::get_loaded()
+    {
+        static std::atomic<bool> _loaded(false);
+        return _loaded;
     }
 
     template <typename T>
@@ -142,22 +557,374 @@ namespace wowgm::game::datastores
     }
 
     template <typename T>
-    auto Storage<T>::get_storage() -> std::unordered_map<uint32_t, T>&
+    auto Storage<T>::get_storage() -> std::vector<T>&
     {
-        static std::unordered_map<uint32_t, T> _storage;
+        static std::vector<T> _storage;
         return _storage;
     }
 
     template <typename T>
-    auto Storage<T>::get_string_table() -> std::vector<uint8_t>&
+    auto Storage<T>::get_mapping() -> std::vector<uint8_t>&
     {
-        static std::vector<uint8_t> _stringTable;
-        return _stringTable;
+        static std::vector<uint8_t> _mapping;
+        return _mapping;
     }
 
-    template struct Storage<MapEntry>;
-    template struct Storage<ItemSparseEntry>;
-    template struct Storage<SpellEntry>;
+    template <typename T>
+    auto Storage<T>::get_records() -> T*&
+    {
+        static T* _records = nullptr;
+        return _records;
+    }
+
+    template <typename T>
+    auto Storage<T>::get_secondary_indexes() -> indexes_type&
+    {
+        static indexes_type _indexes;
+        return _indexes;
+    }
+
+    template <typename T>
+    auto Storage<T>::get_index() -> RecordIndex&
+    {
+        static RecordIndex _index;
+        return _index;
+    }
+
+    template <typename T>
+    auto Storage<T>::get_copy_table() -> std::vector<DB2CopyEntry>&
+    {
+        static std::vector<DB2CopyEntry> _copyTable;
+        return _copyTable;
+    }
+
+    // Every table can be loaded on first access, so every table is instantiated.
+    template struct Storage<AchievementEntry>;
+    template struct Storage<Achievement_CategoryEntry>;
+    template struct Storage<Achievement_CriteriaEntry>;
+    template struct Storage<AnimKitBoneSetAliasEntry>;
+    template struct Storage<AnimKitBoneSetEntry>;
+    template struct Storage<AnimKitConfigBoneSetEntry>;
+    template struct Storage<AnimKitConfigEntry>;
+    template struct Storage<AnimKitEntry>;
+    template struct Storage<AnimKitPriorityEntry>;
+    template struct Storage<AnimKitSegmentEntry>;
+    template struct Storage<AnimReplacementEntry>;
+    template struct Storage<AnimReplacementSetEntry>;
+    template struct Storage<AnimationDataEntry>;
+    template struct Storage<AreaAssignmentEntry>;
+    template struct Storage<AreaGroupEntry>;
+    template struct Storage<AreaPOIEntry>;
+    template struct Storage<AreaPOISortedWorldStateEntry>;
+    template struct Storage<AreaTableEntry>;
+    template struct Storage<AreaTriggerEntry>;
+    template struct Storage<ArmorLocationEntry>;
+    template struct Storage<AuctionHouseEntry>;
+    template struct Storage<BankBagSlotPricesEntry>;
+    template struct Storage<BannedAddOnsEntry>;
+    template struct Storage<BarberShopStyleEntry>;
+    template struct Storage<BattlemasterListEntry>;
+    template struct Storage<CameraModeEntry>;
+    template struct Storage<CameraShakesEntry>;
+    template struct Storage<CastableRaidBuffsEntry>;
+    template struct Storage<Cfg_CategoriesEntry>;
+    template struct Storage<Cfg_ConfigsEntry>;
+    template struct Storage<CharBaseInfoEntry>;
+    template struct Storage<CharHairGeosetsEntry>;
+    template struct Storage<CharSectionsEntry>;
+    template struct Storage<CharStartOutfitEntry>;
+    template struct Storage<CharTitlesEntry>;
+    template struct Storage<CharacterFacialHairStylesEntry>;
+    template struct Storage<ChatChannelsEntry>;
+    template struct Storage<ChatProfanityEntry>;
     template struct Storage<ChrClassesEntry>;
+    template struct Storage<ChrClassesXPowerTypesEntry>;
     template struct Storage<ChrRacesEntry>;
+    template struct Storage<CinematicCameraEntry>;
+    template struct Storage<CinematicSequencesEntry>;
+    template struct Storage<CreatureDisplayInfoEntry>;
+    template struct Storage<CreatureDisplayInfoExtraEntry>;
+    template struct Storage<CreatureFamilyEntry>;
+    template struct Storage<CreatureImmunitiesEntry>;
+    template struct Storage<CreatureModelDataEntry>;
+    template struct Storage<CreatureMovementInfoEntry>;
+    template struct Storage<CreatureSoundDataEntry>;
+    template struct Storage<CreatureSpellDataEntry>;
+    template struct Storage<CreatureTypeEntry>;
+    template struct Storage<CurrencyCategoryEntry>;
+    template struct Storage<CurrencyTypesEntry>;
+    template struct Storage<DanceMovesEntry>;
+    template struct Storage<DeathThudLookupsEntry>;
+    template struct Storage<DeclinedWordCasesEntry>;
+    template struct Storage<DeclinedWordEntry>;
+    template struct Storage<DestructibleModelDataEntry>;
+    template struct Storage<DungeonEncounterEntry>;
+    template struct Storage<DungeonMapChunkEntry>;
+    template struct Storage<DungeonMapEntry>;
+    template struct Storage<DurabilityCostsEntry>;
+    template struct Storage<DurabilityQualityEntry>;
+    template struct Storage<EmotesEntry>;
+    template struct Storage<EmotesTextDataEntry>;
+    template struct Storage<EmotesTextEntry>;
+    template struct Storage<EmotesTextSoundEntry>;
+    template struct Storage<EnvironmentalDamageEntry>;
+    template struct Storage<ExhaustionEntry>;
+    template struct Storage<FactionEntry>;
+    template struct Storage<FactionGroupEntry>;
+    template struct Storage<FactionTemplateEntry>;
+    template struct Storage<FileDataEntry>;
+    template struct Storage<FootprintTexturesEntry>;
+    template struct Storage<FootstepTerrainLookupEntry>;
+    template struct Storage<GMSurveyAnswersEntry>;
+    template struct Storage<GMSurveyCurrentSurveyEntry>;
+    template struct Storage<GMSurveyQuestionsEntry>;
+    template struct Storage<GMSurveySurveysEntry>;
+    template struct Storage<GMTicketCategoryEntry>;
+    template struct Storage<GameObjectArtKitEntry>;
+    template struct Storage<GameObjectDisplayInfoEntry>;
+    template struct Storage<GameTablesEntry>;
+    template struct Storage<GameTipsEntry>;
+    template struct Storage<GemPropertiesEntry>;
+    template struct Storage<GlueScreenEmoteEntry>;
+    template struct Storage<GlyphPropertiesEntry>;
+    template struct Storage<GlyphSlotEntry>;
+    template struct Storage<GroundEffectDoodadEntry>;
+    template struct Storage<GroundEffectTextureEntry>;
+    template struct Storage<GuildColorBackgroundEntry>;
+    template struct Storage<GuildColorBorderEntry>;
+    template struct Storage<GuildColorEmblemEntry>;
+    template struct Storage<GuildPerkSpellsEntry>;
+    template struct Storage<HelmetGeosetVisDataEntry>;
+    template struct Storage<HolidayDescriptionsEntry>;
+    template struct Storage<HolidayNamesEntry>;
+    template struct Storage<HolidaysEntry>;
+    template struct Storage<ImportPriceArmorEntry>;
+    template struct Storage<ImportPriceQualityEntry>;
+    template struct Storage<ImportPriceShieldEntry>;
+    template struct Storage<ImportPriceWeaponEntry>;
+    template struct Storage<ItemArmorQualityEntry>;
+    template struct Storage<ItemArmorShieldEntry>;
+    template struct Storage<ItemArmorTotalEntry>;
+    template struct Storage<ItemBagFamilyEntry>;
+    template struct Storage<ItemClassEntry>;
+    template struct Storage<ItemCurrencyCostEntry>;
+    template struct Storage<ItemDamageAmmoEntry>;
+    template struct Storage<ItemDamageOneHandCasterEntry>;
+    template struct Storage<ItemDamageOneHandEntry>;
+    template struct Storage<ItemDamageRangedEntry>;
+    template struct Storage<ItemDamageThrownEntry>;
+    template struct Storage<ItemDamageTwoHandCasterEntry>;
+    template struct Storage<ItemDamageTwoHandEntry>;
+    template struct Storage<ItemDamageWandEntry>;
+    template struct Storage<ItemDisenchantLootEntry>;
+    template struct Storage<ItemDisplayInfoEntry>;
+    template struct Storage<ItemEntry>;
+    template struct Storage<ItemExtendedCostEntry>;
+    template struct Storage<ItemGroupSoundsEntry>;
+    template struct Storage<ItemLimitCategoryEntry>;
+    template struct Storage<ItemNameDescriptionEntry>;
+    template struct Storage<ItemPetFoodEntry>;
+    template struct Storage<ItemPriceBaseEntry>;
+    template struct Storage<ItemPurchaseGroupEntry>;
+    template struct Storage<ItemRandomPropertiesEntry>;
+    template struct Storage<ItemRandomSuffixEntry>;
+    template struct Storage<ItemReforgeEntry>;
+    template struct Storage<ItemSetEntry>;
+    template struct Storage<ItemSparseEntry>;
+    template struct Storage<ItemSubClassEntry>;
+    template struct Storage<ItemSubClassMaskEntry>;
+    template struct Storage<ItemVisualEffectsEntry>;
+    template struct Storage<ItemVisualsEntry>;
+    template struct Storage<JournalEncounterCreatureEntry>;
+    template struct Storage<JournalEncounterEntry>;
+    template struct Storage<JournalEncounterItemEntry>;
+    template struct Storage<JournalEncounterSectionEntry>;
+    template struct Storage<JournalInstanceEntry>;
+    template struct Storage<KeyChainEntry>;
+    template struct Storage<LanguageWordsEntry>;
+    template struct Storage<LanguagesEntry>;
+    template struct Storage<LfgDungeonExpansionEntry>;
+    template struct Storage<LfgDungeonGroupEntry>;
+    template struct Storage<LfgDungeonsEntry>;
+    template struct Storage<LfgDungeonsGroupingMapEntry>;
+    template struct Storage<LightEntry>;
+    template struct Storage<LightFloatBandEntry>;
+    template struct Storage<LightIntBandEntry>;
+    template struct Storage<LightParamsEntry>;
+    template struct Storage<LightSkyboxEntry>;
+    template struct Storage<LiquidMaterialEntry>;
+    template struct Storage<LiquidObjectEntry>;
+    template struct Storage<LiquidTypeEntry>;
+    template struct Storage<LoadingScreenTaxiSplinesEntry>;
+    template struct Storage<LoadingScreensEntry>;
+    template struct Storage<LockEntry>;
+    template struct Storage<LockTypeEntry>;
+    template struct Storage<MailTemplateEntry>;
+    template struct Storage<MapDifficultyEntry>;
+    template struct Storage<MapEntry>;
+    template struct Storage<MaterialEntry>;
+    template struct Storage<MountCapabilityEntry>;
+    template struct Storage<MountTypeEntry>;
+    template struct Storage<MovieEntry>;
+    template struct Storage<MovieFileDataEntry>;
+    template struct Storage<MovieVariationEntry>;
+    template struct Storage<NPCSoundsEntry>;
+    template struct Storage<NameGenEntry>;
+    template struct Storage<NamesProfanityEntry>;
+    template struct Storage<NamesReservedEntry>;
+    template struct Storage<NumTalentsAtLevelEntry>;
+    template struct Storage<ObjectEffectEntry>;
+    template struct Storage<ObjectEffectGroupEntry>;
+    template struct Storage<ObjectEffectModifierEntry>;
+    template struct Storage<ObjectEffectPackageElemEntry>;
+    template struct Storage<ObjectEffectPackageEntry>;
+    template struct Storage<OverrideSpellDataEntry>;
+    template struct Storage<PackageEntry>;
+    template struct Storage<PageTextMaterialEntry>;
+    template struct Storage<PaperDollItemFrameEntry>;
+    template struct Storage<ParticleColorEntry>;
+    template struct Storage<PhaseEntry>;
+    template struct Storage<PhaseShiftZoneSoundsEntry>;
+    template struct Storage<PhaseXPhaseGroupEntry>;
+    template struct Storage<PlayerConditionEntry>;
+    template struct Storage<PowerDisplayEntry>;
+    template struct Storage<PvpDifficultyEntry>;
+    template struct Storage<QuestFactionRewardEntry>;
+    template struct Storage<QuestInfoEntry>;
+    template struct Storage<QuestPOIBlobEntry>;
+    template struct Storage<QuestPOIPointEntry>;
+    template struct Storage<QuestSortEntry>;
+    template struct Storage<QuestXPEntry>;
+    template struct Storage<RandPropPointsEntry>;
+    template struct Storage<ResearchBranchEntry>;
+    template struct Storage<ResearchFieldEntry>;
+    template struct Storage<ResearchProjectEntry>;
+    template struct Storage<ResearchSiteEntry>;
+    template struct Storage<ResistancesEntry>;
+    template struct Storage<ScalingStatDistributionEntry>;
+    template struct Storage<ScalingStatValuesEntry>;
+    template struct Storage<ScreenEffectEntry>;
+    template struct Storage<ScreenLocationEntry>;
+    template struct Storage<ServerMessagesEntry>;
+    template struct Storage<SkillLineAbilityEntry>;
+    template struct Storage<SkillLineAbilitySortedSpellEntry>;
+    template struct Storage<SkillLineCategoryEntry>;
+    template struct Storage<SkillLineEntry>;
+    template struct Storage<SkillRaceClassInfoEntry>;
+    template struct Storage<SkillTiersEntry>;
+    template struct Storage<SoundAmbienceEntry>;
+    template struct Storage<SoundAmbienceFlavorEntry>;
+    template struct Storage<SoundEmitterPillPointsEntry>;
+    template struct Storage<SoundEmittersEntry>;
+    template struct Storage<SoundEntriesAdvancedEntry>;
+    template struct Storage<SoundEntriesEntry>;
+    template struct Storage<SoundEntriesFallbacksEntry>;
+    template struct Storage<SoundFilterElemEntry>;
+    template struct Storage<SoundFilterEntry>;
+    template struct Storage<SoundProviderPreferencesEntry>;
+    template struct Storage<SpamMessagesEntry>;
+    template struct Storage<SpellActivationOverlayEntry>;
+    template struct Storage<SpellAuraOptionsEntry>;
+    template struct Storage<SpellAuraRestrictionsEntry>;
+    template struct Storage<SpellAuraVisXTalentTabEntry>;
+    template struct Storage<SpellAuraVisibilityEntry>;
+    template struct Storage<SpellCastTimesEntry>;
+    template struct Storage<SpellCastingRequirementsEntry>;
+    template struct Storage<SpellCategoriesEntry>;
+    template struct Storage<SpellCategoryEntry>;
+    template struct Storage<SpellChainEffectsEntry>;
+    template struct Storage<SpellClassOptionsEntry>;
+    template struct Storage<SpellCooldownsEntry>;
+    template struct Storage<SpellDescriptionVariablesEntry>;
+    template struct Storage<SpellDifficultyEntry>;
+    template struct Storage<SpellDispelTypeEntry>;
+    template struct Storage<SpellDurationEntry>;
+    template struct Storage<SpellEffectCameraShakesEntry>;
+    template struct Storage<SpellEffectEntry>;
+    template struct Storage<SpellEntry>;
+    template struct Storage<SpellEquippedItemsEntry>;
+    template struct Storage<SpellFlyoutEntry>;
+    template struct Storage<SpellFlyoutItemEntry>;
+    template struct Storage<SpellFocusObjectEntry>;
+    template struct Storage<SpellIconEntry>;
+    template struct Storage<SpellInterruptsEntry>;
+    template struct Storage<SpellItemEnchantmentConditionEntry>;
+    template struct Storage<SpellItemEnchantmentEntry>;
+    template struct Storage<SpellLevelsEntry>;
+    template struct Storage<SpellMechanicEntry>;
+    template struct Storage<SpellMissileEntry>;
+    template struct Storage<SpellMissileMotionEntry>;
+    template struct Storage<SpellPowerEntry>;
+    template struct Storage<SpellRadiusEntry>;
+    template struct Storage<SpellRangeEntry>;
+    template struct Storage<SpellReagentsEntry>;
+    template struct Storage<SpellRuneCostEntry>;
+    template struct Storage<SpellScalingEntry>;
+    template struct Storage<SpellShapeshiftEntry>;
+    template struct Storage<SpellShapeshiftFormEntry>;
+    template struct Storage<SpellSpecialUnitEffectEntry>;
+    template struct Storage<SpellTargetRestrictionsEntry>;
+    template struct Storage<SpellTotemsEntry>;
+    template struct Storage<SpellVisualEffectNameEntry>;
+    template struct Storage<SpellVisualEntry>;
+    template struct Storage<SpellVisualKitAreaModelEntry>;
+    template struct Storage<SpellVisualKitEntry>;
+    template struct Storage<SpellVisualKitModelAttachEntry>;
+    template struct Storage<Startup_StringsEntry>;
+    template struct Storage<StationeryEntry>;
+    template struct Storage<StringLookupsEntry>;
+    template struct Storage<SummonPropertiesEntry>;
+    template struct Storage<TalentEntry>;
+    template struct Storage<TalentTabEntry>;
+    template struct Storage<TalentTreePrimarySpellsEntry>;
+    template struct Storage<TaxiNodesEntry>;
+    template struct Storage<TaxiPathEntry>;
+    template struct Storage<TaxiPathNodeEntry>;
+    template struct Storage<TerrainMaterialEntry>;
+    template struct Storage<TerrainTypeEntry>;
+    template struct Storage<TerrainTypeSoundsEntry>;
+    template struct Storage<TotemCategoryEntry>;
+    template struct Storage<TransportAnimationEntry>;
+    template struct Storage<TransportPhysicsEntry>;
+    template struct Storage<TransportRotationEntry>;
+    template struct Storage<UnitBloodEntry>;
+    template struct Storage<UnitBloodLevelsEntry>;
+    template struct Storage<UnitPowerBarEntry>;
+    template struct Storage<VehicleEntry>;
+    template struct Storage<VehicleSeatEntry>;
+    template struct Storage<VehicleUIIndSeatEntry>;
+    template struct Storage<VehicleUIIndicatorEntry>;
+    template struct Storage<VideoHardwareEntry>;
+    template struct Storage<VocalUISoundsEntry>;
+    template struct Storage<WMOAreaTableEntry>;
+    template struct Storage<WeaponImpactSoundsEntry>;
+    template struct Storage<WeaponSwingSounds2Entry>;
+    template struct Storage<WeatherEntry>;
+    template struct Storage<WorldChunkSoundsEntry>;
+    template struct Storage<WorldMapAreaEntry>;
+    template struct Storage<WorldMapContinentEntry>;
+    template struct Storage<WorldMapOverlayEntry>;
+    template struct Storage<WorldMapTransformsEntry>;
+    template struct Storage<WorldSafeLocsEntry>;
+    template struct Storage<WorldStateUIEntry>;
+    template struct Storage<WorldStateZoneSoundsEntry>;
+    template struct Storage<World_PVP_AreaEntry>;
+    template struct Storage<ZoneIntroMusicTableEntry>;
+    template struct Storage<ZoneLightEntry>;
+    template struct Storage<ZoneLightPointEntry>;
+    template struct Storage<ZoneMusicEntry>;
+    template struct Storage<gtBarberShopCostBaseEntry>;
+    template struct Storage<gtChanceToMeleeCritBaseEntry>;
+    template struct Storage<gtChanceToMeleeCritEntry>;
+    template struct Storage<gtChanceToSpellCritBaseEntry>;
+    template struct Storage<gtChanceToSpellCritEntry>;
+    template struct Storage<gtCombatRatingsEntry>;
+    template struct Storage<gtNPCManaCostScalerEntry>;
+    template struct Storage<gtOCTBaseHPByClassEntry>;
+    template struct Storage<gtOCTBaseMPByClassEntry>;
+    template struct Storage<gtOCTClassCombatRatingScalarEntry>;
+    template struct Storage<gtOCTHpPerStaminaEntry>;
+    template struct Storage<gtOCTRegenMPEntry>;
+    template struct Storage<gtRegenMPPerSptEntry>;
+    template struct Storage<gtSpellScalingEntry>;
 }
@@ -1,13 +1,22 @@
 #pragma once
 
+#include <atomic>
 #include <cstdint>
+#include <mutex>
+#include <tuple>
 #include <string>
 #include <type_traits>
+#include <vector>
 
 #include <shared/filesystem/mpq_file_system.hpp>
 #include <shared/assert/assert.hpp>
 
 #include "DBTraits.hpp"
+#include "DBLayout.hpp"
+#include "DBDecoder.hpp"
+#include "DBRecordIndex.hpp"
+#include "DBIndexes.hpp"
+#include "DBStringPool.hpp"
 
 namespace wowgm::game::datastores
 {
@@ -38,6 +47,39 @@ namespace wowgm::game::datastores
         uint32_t CopyTableSize;
     };
 
+    /// Entry of a WDB2 copy table: {@link NewID} names the same record as {@link SourceID}.
+    struct DB2CopyEntry
+    {
+        uint32_t NewID;
+        uint32_t SourceID;
+    };
+
+    /// Leads a decoded table snapshot. Followed by the file header, the decoded records, the string pool and the copy table.
+    struct DBSnapshotHeader
+    {
+        uint32_t Magic;
+        uint32_t Version;
+        uint64_t Key;
+        uint32_t RecordSize;
+        uint32_t RecordCount;
+        uint32_t StringPoolSize;
+        uint32_t CopyCount;
+    };
+
+    /// Contiguous run of records, as stored by a table.
+    template <typename T>
+    struct RecordSpan
+    {
+        T const* First = nullptr;
+        T const* Last = nullptr;
+
+        T const* begin() const { return First; }
+        T const* end() const { return Last; }
+
+        size_t size() const { return size_t(Last - First); }
+        bool empty() const { return First == Last; }
+    };
+
     template <typename T>
     struct Storage
     {
@@ -47,19 +89,104 @@ namespace wowgm::game::datastores
         using header_type = typename std::conditional<meta_t::sparse_storage, DB2Header, DBCHeader>::type;
         using record_type = T;
 
+        using indexes_type = typename secondary_indexes<T>::type;
+
+        static_assert(alignof(T) == 1, "Structures passed to Storage<T, ...> must be aligned to 1 byte. Use #pragma pack(push, 1)!");
+        static_assert(detail::decoded_record_size<meta_t>() == sizeof(T), "Structure does not match its meta. Re-generate file metadata.");
+
+        /// Records of mapped tables are served straight from the file contents instead of being decoded.
+        constexpr static const bool is_mapped = detail::is_layout_compatible<meta_t, T>();
+
+        /// Reads the table from its snapshot or the MPQ archives, replacing whatever was loaded before.
         static void Initialize();
 
-        static void LoadRecords(uint8_t const* data);
+        /// Runs {@link Initialize} the first time any thread calls this; every other caller waits for it to finish.
+        static void Load();
+
+        static bool IsLoaded();
+
+        /**
+         * Replaces the table with the one in {@param fileData}, the contents of a WDBC or WDB2 file, and marks it
+         * loaded without going through snapshots or the MPQ archives. Nothing may read the table meanwhile.
+         */
+        static void LoadFromMemory(std::vector<uint8_t> fileData);
 
-        static void CopyToMemory(uint32_t index, uint8_t const* data);
+        /// Offset of the first record in a file that starts with {@param header}.
+        static size_t GetRecordOffset(header_type const& header);
 
+        /// Decodes records from {@param data}, pointing string members into {@param stringTable}.
+        static void LoadRecords(uint8_t const* data, uint8_t const* stringTable);
+
+        /// Points records at {@param data} in place, relocating string offsets into pointers into {@param stringTable}.
+        static void MapRecords(uint8_t* data, uint8_t const* stringTable);
+
+        /// Restores the decoded table from its snapshot. Returns false if there is none or if it is stale.
+        static bool LoadSnapshot(uint64_t key);
+
+        /// Writes the decoded table to its snapshot.
+        static void SaveSnapshot(uint64_t key);
+
+        /// Loads the table on first use. Returns nullptr if there is no record with that ID.
         static T* GetRecord(uint32_t index);
 
+        /// Loads the table on first use.
+        static uint32_t GetRecordCount();
+
+        /// Loads the table on first use and returns every record, in file order. Copied rows are not repeated.
+        static RecordSpan<T> GetRecords();
+
+        /// Loads the table on first use and returns one of the secondary indexes declared in {@link secondary_indexes<T>}.
+        template <typename Index>
+        static Index const& ByIndex()
+        {
+            Load();
+            return std::get<Index>(get_secondary_indexes());
+        }
+
     private:
-        static header_type& get_header();
-        static std::unordered_map<uint32_t, T>& get_storage();
+        /// Decodes, interns and indexes the table held by {@param fileData}, the contents of its file.
+        static void ReadFile(std::vector<uint8_t> fileData);
+
+        /// Indexes the loaded records by reading their IDs.
+        static void BuildIndex();
+
+        /**
+         * Indexes the loaded records from the WDB2 index block at {@param indexBlock}, which lists the row of every ID
+         * in [MinIndex, MaxIndex]. Returns false if the file has no such block or if it does not match the records.
+         */
+        static bool BuildIndexFromBlock(uint8_t const* indexBlock);
 
-        static std::vector<uint8_t>& get_string_table();
+        /// Prepares the ID index for [{@param minID}, {@param maxID}], widened to fit the copy table.
+        static void ResetIndex(uint32_t minID, uint32_t maxID);
+
+        /// Points the IDs of copied rows at their source record.
+        static void InsertCopies();
+
+        static uint32_t GetRecordID(uint32_t slot);
+
+        static void BuildSecondaryIndexes();
+
+        /// Combines the MPQ content stamp with the meta layout. Zero disables snapshots.
+        static uint64_t GetSnapshotKey();
+        static std::string GetSnapshotPath();
+
+        /// Repoints every string member of the loaded records at its copy in the shared {@link StringPool}.
+        static void InternStrings();
+
+        /// Invokes {@param f} with the address of every string member of the decoded {@param record}.
+        template <typename F>
+        static void ForEachString(uint8_t* record, F&& f);
+
+        static std::once_flag& get_load_flag();
+        static std::atomic<bool>& get_loaded();
+
+        static header_type& get_header();
+        static std::vector<T>& get_storage();
+        static std::vector<uint8_t>& get_mapping();
+        static T*& get_records();
+        static RecordIndex& get_index();
+        static std::vector<DB2CopyEntry>& get_copy_table();
+        static indexes_type& get_secondary_indexes();
     };
 
 }
@@ -0,0 +1,77 @@
+#include "DBStringPool.hpp"
+
+#include <shared/assert/assert.hpp>
+
+#include <algorithm>
+#include <mutex>
+
+namespace wowgm::game::datastores
+{
+    StringPool* StringPool::instance()
+    {
+        static StringPool instance;
+        return &instance;
+    }
+
+    StringPool::StringPool() : _chunks(std::make_unique<std::unique_ptr<char[]>[]>(MaxChunks))
+    {
+        // Lands at the very start of the first chunk, making it handle 0.
+        Intern(std::string_view());
+        _statistics.InternedBytes = 0;
+    }
+
+    StringHandle StringPool::Intern(std::string_view value)
+    {
+        std::unique_lock<std::shared_mutex> lock(_lock);
+
+        _statistics.InternedBytes += value.size() + 1;
+
+        auto itr = _handles.find(value);
+        if (itr != _handles.end())
+            return itr->second;
+
+        // Length, characters, terminator, padded so that every entry can be addressed by a 4-byte aligned handle.
+        size_t entrySize = (sizeof(uint32_t) + value.size() + 1 + 3) & ~size_t(3);
+        if (_chunkUsage + entrySize > ChunkSize)
+        {
+            if (_chunkCount == MaxChunks)
+                shared::assert::throw_with_trace("String pool exhausted.");
+
+            // Strings larger than a chunk get one of their own.
+            _chunks[_chunkCount++].reset(new char[std::max(ChunkSize, entrySize)]);
+            _chunkUsage = 0;
+        }
+
+        uint32_t chunk = _chunkCount - 1;
+        char* entry = _chunks[chunk].get() + _chunkUsage;
+
+        uint32_t length = uint32_t(value.size());
+        memcpy(entry, &length, sizeof(uint32_t));
+        if (!value.empty())
+            memcpy(entry + sizeof(uint32_t), value.data(), value.size());
+        entry[sizeof(uint32_t) + value.size()] = '\0';
+
+        StringHandle handle = (chunk << OffsetBits) | uint32_t(_chunkUsage / 4u);
+        _chunkUsage += entrySize;
+
+        _statistics.StoredBytes += entrySize;
+        ++_statistics.StringCount;
+
+        _handles.emplace(std::string_view(entry + sizeof(uint32_t), value.size()), handle);
+        return handle;
+    }
+
+    StringHandle StringPool::Find(std::string_view value) const
+    {
+        std::shared_lock<std::shared_mutex> lock(_lock);
+
+        auto itr = _handles.find(value);
+        return itr != _handles.end() ? itr->second : npos;
+    }
+
+    StringPoolStatistics StringPool::GetStatistics() const
+    {
+        std::shared_lock<std::shared_mutex> lock(_lock);
+        return _statistics;
+    }
+}
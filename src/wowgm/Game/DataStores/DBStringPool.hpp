@@ -0,0 +1,85 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <shared_mutex>
+#include <string_view>
+
+#include <extstd/containers/flat_hash_map.hpp>
+
+namespace wowgm::game::datastores
+{
+    /// Names an interned string. Equal strings always get the same handle; 0 is the empty string.
+    using StringHandle = uint32_t;
+
+    struct StringPoolStatistics
+    {
+        size_t StringCount = 0;
+        /// Bytes held by the pool, headers and padding included.
+        size_t StoredBytes = 0;
+        /// Bytes of every string ever interned, duplicates included.
+        size_t InternedBytes = 0;
+
+        /// Bytes that would have been stored without deduplication.
+        size_t GetSavedBytes() const { return InternedBytes > StoredBytes ? InternedBytes - StoredBytes : 0; }
+    };
+
+    /**
+     * Process-wide arena of the strings of every loaded table.
+     *
+     * Each distinct string is stored once, NUL-terminated, and never moves. Records of all tables point at the
+     * same copy, so two string members are equal exactly when they hold the same pointer, and two handles are
+     * equal exactly when they name the same string.
+     */
+    class StringPool final
+    {
+        constexpr static const uint32_t OffsetBits = 18;
+        constexpr static const uint32_t MaxChunks = 1u << (32 - OffsetBits);
+
+        /// Strings are laid out on 4-byte boundaries, which handles count in.
+        constexpr static const size_t ChunkSize = size_t(4) << OffsetBits;
+
+    public:
+        constexpr static const StringHandle npos = 0xFFFFFFFFu;
+
+        static StringPool* instance();
+
+        StringPool();
+
+        /// Returns the handle of {@param value}, storing it first if no table interned it yet.
+        StringHandle Intern(std::string_view value);
+
+        /// Returns {@link npos} if {@param value} was never interned.
+        StringHandle Find(std::string_view value) const;
+
+        std::string_view Get(StringHandle handle) const
+        {
+            char const* value = GetCString(handle);
+            uint32_t length;
+            memcpy(&length, value - sizeof(uint32_t), sizeof(uint32_t));
+            return std::string_view(value, length);
+        }
+
+        char const* GetCString(StringHandle handle) const
+        {
+            return _chunks[handle >> OffsetBits].get() + size_t(handle & ((1u << OffsetBits) - 1)) * 4u + sizeof(uint32_t);
+        }
+
+        StringPoolStatistics GetStatistics() const;
+
+    private:
+        mutable std::shared_mutex _lock;
+
+        /// Chunks are only ever appended, so resolving a handle needs no lock.
+        std::unique_ptr<std::unique_ptr<char[]>[]> _chunks;
+        uint32_t _chunkCount = 0;
+        size_t _chunkUsage = ChunkSize;
+
+        extstd::containers::flat_hash_map<std::string_view, StringHandle> _handles;
+        StringPoolStatistics _statistics;
+    };
+}
+
+#define sStringPool wowgm::game::datastores::StringPool::instance()
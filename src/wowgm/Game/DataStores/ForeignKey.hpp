@@ -1,29 +1,40 @@
 #pragma once
 
 #include "DBC.hpp"
-#include "DBCStructures.hpp"
-#include "DBTraits.hpp"
 
 #include <cstddef>
+#include <cstdint>
 #include <type_traits>
 
 namespace wowgm::game::structures
 {
+#pragma pack(push, 1)
+    /// Record member holding the ID of a record of another table, resolved through the ID index of {@param T} on every access.
     template <typename T>
     struct ForeignKey
     {
         static_assert(!std::is_same<T, std::nullptr_t>::value, "");
 
+        constexpr static const uint32_t Null = 0xFFFFFFFFu;
+
     private:
         uint32_t Value;
 
     public:
-        T const* operator -> ()
+        T const* operator -> () const { return Resolve(); }
+
+        explicit operator bool () const { return Resolve() != nullptr; }
+
+        /// Returns nullptr if the key is null or if there is no record with that ID.
+        T const* Resolve() const
         {
-            if (Value = 0xFFFFFFFF)
+            if (Value == Null)
                 return nullptr;
 
-            return DataStores::GetRecord<T>(Value);
+            return datastores::DataStores::GetRecord<T>(Value);
         }
+
+        uint32_t GetID() const { return Value; }
     };
-}
\ No newline at end of file
+#pragma pack(pop)
+}
@@ -38,22 +38,6 @@ namespace wowgm::game::entities
     uint32_t CGContainer::UpdateDescriptors(JamCliValuesUpdate& valuesUpdate)
     {
         uint32_t startOffset = CGItem::UpdateDescriptors(valuesUpdate);
-        uint8_t* itemDatabase = reinterpret_cast<uint8_t*>(&GetContainerData());
-
-        auto itr = valuesUpdate.Descriptors.begin();
-        while (itr != valuesUpdate.Descriptors.end())
-        {
-            uint32_t calculatedOffset = itr->first * 4 - startOffset;
-            if (calculatedOffset > sizeof(CGContainerData))
-            {
-                ++itr;
-                continue;
-            }
-
-            *reinterpret_cast<uint32_t*>(itemDatabase + calculatedOffset) = itr->second;
-            itr = valuesUpdate.Descriptors.erase(itr);
-        }
-
-        return startOffset + sizeof(CGContainerData);
+        return ApplyDescriptors(reinterpret_cast<uint8_t*>(&GetContainerData()), startOffset, sizeof(CGContainerData), valuesUpdate);
     }
 }
@@ -23,6 +23,7 @@ namespace wowgm::game::entities
 #pragma pack(pop)
 
     static_assert(sizeof(CGContainerData) == sizeof(uint32_t) * 74);
+    static_assert(descriptor_block<CGContainerData>::offset * 4 == sizeof(CGObjectData) + sizeof(CGItemData));
 
     class CGContainer : public CGContainerData, public CGItem
     {
@@ -50,23 +50,6 @@ namespace wowgm::game::entities
     uint32_t CGItem::UpdateDescriptors(JamCliValuesUpdate& valuesUpdate)
     {
         uint32_t startOffset = CGObject::UpdateDescriptors(valuesUpdate);
-
-        uint8_t* itemDataBase = reinterpret_cast<uint8_t*>(&GetItemData());
-
-        auto itr = valuesUpdate.Descriptors.begin();
-        while (itr != valuesUpdate.Descriptors.end())
-        {
-            uint32_t calculatedOffset = itr->first * 4 - startOffset;
-            if (calculatedOffset > sizeof(CGItemData))
-            {
-                ++itr;
-                continue;
-            }
-
-            *reinterpret_cast<uint32_t*>(itemDataBase + calculatedOffset) = itr->second;
-            itr = valuesUpdate.Descriptors.erase(itr);
-        }
-
-        return startOffset + sizeof(CGItemData);
+        return ApplyDescriptors(reinterpret_cast<uint8_t*>(&GetItemData()), startOffset, sizeof(CGItemData), valuesUpdate);
     }
 }
@@ -44,6 +44,7 @@ namespace wowgm::game::entities
 #pragma pack(pop)
 
     static_assert(sizeof(CGItemData) == sizeof(uint32_t) * 66);
+    static_assert(descriptor_block<CGItemData>::offset * 4 == sizeof(CGObjectData));
 
     class CGItem : public CGItemData, public CGObject
     {
@@ -10,6 +10,8 @@ namespace wowgm::game::entities
 
     CGObject::CGObject(CClientObjCreate const& objCreate)
     {
+        GUID = objCreate.GUID;
+
         C3Vector& position = GetPosition();
         position = objCreate.Movement.Position;
     }
@@ -98,23 +100,38 @@ namespace wowgm::game::entities
 
     uint32_t CGObject::UpdateDescriptors(JamCliValuesUpdate& valuesUpdate)
     {
-        uint8_t* objectDataBase = reinterpret_cast<uint8_t*>(&GetObjectData());
+        return ApplyDescriptors(reinterpret_cast<uint8_t*>(&GetObjectData()), 0, sizeof(CGObjectData), valuesUpdate);
+    }
 
+    uint32_t CGObject::ApplyDescriptors(uint8_t* dataBlock, uint32_t startOffset, uint32_t blockSize, JamCliValuesUpdate& valuesUpdate)
+    {
         auto itr = valuesUpdate.Descriptors.begin();
         while (itr != valuesUpdate.Descriptors.end())
         {
             uint32_t calculatedOffset = itr->first * 4;
-            if (calculatedOffset > sizeof(CGObjectData))
+            if (calculatedOffset < startOffset || calculatedOffset - startOffset >= blockSize)
             {
                 ++itr;
                 continue;
             }
 
-            *reinterpret_cast<uint32_t*>(objectDataBase + calculatedOffset) = itr->second;
+            *reinterpret_cast<uint32_t*>(dataBlock + calculatedOffset - startOffset) = itr->second;
+            _changedDescriptors.set(itr->first);
+
             itr = valuesUpdate.Descriptors.erase(itr);
         }
 
-        return sizeof(CGObjectData);
+        return startOffset + blockSize;
+    }
+
+    DescriptorMask const& CGObject::GetChangedDescriptors() const
+    {
+        return _changedDescriptors;
+    }
+
+    void CGObject::ClearChangedDescriptors()
+    {
+        _changedDescriptors.reset();
     }
 
     TypeMask CGObject::GetTypeMask() const
@@ -4,6 +4,7 @@
 #include "C3Vector.hpp"
 #include "JamCliValuesUpdate.hpp"
 #include "CClientObjCreate.hpp"
+#include "DescriptorFields.hpp"
 
 #include <type_traits>
 #include <cstdint>
@@ -48,6 +49,10 @@ namespace wowgm::game::entities
 
         virtual uint32_t UpdateDescriptors(JamCliValuesUpdate& valuesUpdate);
 
+        /// Descriptors written since the last call to ClearChangedDescriptors().
+        DescriptorMask const& GetChangedDescriptors() const;
+        void ClearChangedDescriptors();
+
         virtual CGUnit* ToUnit();
         virtual CGUnit const* ToUnit() const;
 
@@ -67,5 +72,20 @@ namespace wowgm::game::entities
         C3Vector const& GetPosition() const;
 
         TypeMask GetTypeMask() const;
+
+    protected:
+        /**
+         * Consumes every descriptor of {@param valuesUpdate} that falls within a data block.
+         *
+         * @param[in] dataBlock   The first byte of the data block.
+         * @param[in] startOffset The byte offset of the data block within the descriptor space.
+         * @param[in] blockSize   The size of the data block, in bytes.
+         *
+         * @returns The byte offset of the next data block.
+         */
+        uint32_t ApplyDescriptors(uint8_t* dataBlock, uint32_t startOffset, uint32_t blockSize, JamCliValuesUpdate& valuesUpdate);
+
+    private:
+        DescriptorMask _changedDescriptors;
     };
 }
\ No newline at end of file
@@ -37,23 +37,6 @@ namespace wowgm::game::entities
     uint32_t CGPlayer::UpdateDescriptors(JamCliValuesUpdate& valuesUpdate)
     {
         uint32_t startOffset = CGUnit::UpdateDescriptors(valuesUpdate);
-
-        uint8_t* unitDatabase = reinterpret_cast<uint8_t*>(&GetPlayerData());
-
-        auto itr = valuesUpdate.Descriptors.begin();
-        while (itr != valuesUpdate.Descriptors.end())
-        {
-            uint32_t calculatedOffset = itr->first * 4 - startOffset;
-            if (calculatedOffset > sizeof(CGPlayerData))
-            {
-                ++itr;
-                continue;
-            }
-
-            *reinterpret_cast<uint32_t*>(unitDatabase + calculatedOffset) = itr->second;
-            itr = valuesUpdate.Descriptors.erase(itr);
-        }
-
-        return startOffset + sizeof(CGPlayerData);
+        return ApplyDescriptors(reinterpret_cast<uint8_t*>(&GetPlayerData()), startOffset, sizeof(CGPlayerData), valuesUpdate);
     }
 }
@@ -122,6 +122,8 @@ namespace wowgm::game::entities
 #pragma pack(pop)
 
     static_assert(sizeof(CGPlayerData) == sizeof(uint32_t) * 0x04D6);
+    static_assert(descriptor_block<CGPlayerData>::offset * 4 == sizeof(CGObjectData) + sizeof(CGUnitData));
+    static_assert(descriptor_block<CGPlayerData>::offset * 4 + sizeof(CGPlayerData) == MAX_DESCRIPTOR_COUNT * 4);
 
     class CGPlayer : public CGUnit, public CGPlayerData
     {
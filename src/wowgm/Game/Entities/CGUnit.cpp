@@ -37,22 +37,6 @@ namespace wowgm::game::entities
     uint32_t CGUnit::UpdateDescriptors(JamCliValuesUpdate& valuesUpdate)
     {
         uint32_t startOffset = CGObject::UpdateDescriptors(valuesUpdate);
-        uint8_t* unitDatabase = reinterpret_cast<uint8_t*>(&GetUnitData());
-
-        auto itr = valuesUpdate.Descriptors.begin();
-        while (itr != valuesUpdate.Descriptors.end())
-        {
-            uint32_t calculatedOffset = itr->first * 4 - startOffset;
-            if (calculatedOffset > sizeof(CGUnitData))
-            {
-                ++itr;
-                continue;
-            }
-
-            *reinterpret_cast<uint32_t*>(unitDatabase + calculatedOffset) = itr->second;
-            itr = valuesUpdate.Descriptors.erase(itr);
-        }
-
-        return startOffset + sizeof(CGUnitData);
+        return ApplyDescriptors(reinterpret_cast<uint8_t*>(&GetUnitData()), startOffset, sizeof(CGUnitData), valuesUpdate);
     }
 }
@@ -110,6 +110,7 @@ namespace wowgm::game::entities
 #pragma pack(pop)
 
     static_assert(sizeof(CGUnitData) == sizeof(uint32_t) * 0x008A);
+    static_assert(descriptor_block<CGUnitData>::offset * 4 == sizeof(CGObjectData));
 
     class CGUnit : public CGObject, public CGUnitData
     {
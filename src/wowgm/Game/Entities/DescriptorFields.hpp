@@ -0,0 +1,52 @@
+#pragma once
+
+#include <bitset>
+#include <cstddef>
+#include <cstdint>
+
+namespace wowgm::game::entities
+{
+    struct CGObjectData;
+    struct CGItemData;
+    struct CGContainerData;
+    struct CGUnitData;
+    struct CGPlayerData;
+
+    /// Descriptor count of the largest object type (OBJECT + UNIT + PLAYER blocks).
+    constexpr static const uint32_t MAX_DESCRIPTOR_COUNT = 0x0008 + 0x008A + 0x04D6;
+
+    /// One bit per descriptor (32-bit update field), indexed like the update mask sent by the server.
+    using DescriptorMask = std::bitset<MAX_DESCRIPTOR_COUNT>;
+
+    /// Index of the first descriptor of each data block.
+    template <typename T> struct descriptor_block { };
+
+    template <> struct descriptor_block<CGObjectData>    { constexpr static const uint32_t offset = 0x0000; };
+    template <> struct descriptor_block<CGItemData>      { constexpr static const uint32_t offset = 0x0008; };
+    template <> struct descriptor_block<CGContainerData> { constexpr static const uint32_t offset = 0x004A; };
+    template <> struct descriptor_block<CGUnitData>      { constexpr static const uint32_t offset = 0x0008; };
+    template <> struct descriptor_block<CGPlayerData>    { constexpr static const uint32_t offset = 0x0092; };
+
+    /// A contiguous range of descriptors, [Begin, Begin + Count).
+    struct DescriptorRange
+    {
+        uint32_t Begin;
+        uint32_t Count;
+
+        template <typename T>
+        static DescriptorRange Of(size_t memberOffset, size_t memberSize)
+        {
+            return { descriptor_block<T>::offset + uint32_t(memberOffset / 4), uint32_t((memberSize + 3) / 4) };
+        }
+
+        void AppendTo(DescriptorMask& mask) const
+        {
+            for (uint32_t i = Begin; i < Begin + Count && i < MAX_DESCRIPTOR_COUNT; ++i)
+                mask.set(i);
+        }
+    };
+}
+
+/// Descriptor range covered by a member of a data block, i.e. DESCRIPTOR_RANGE(CGUnitData, Powers).
+#define DESCRIPTOR_RANGE(Block, Member) \
+    wowgm::game::entities::DescriptorRange::Of<Block>(offsetof(Block, Member), sizeof(Block::Member))
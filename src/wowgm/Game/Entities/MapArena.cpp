@@ -0,0 +1,25 @@
+#include "MapArena.hpp"
+
+namespace wowgm::game::entities
+{
+    MapArena::MapArena(uint32_t mapID) : _mapID(mapID)
+    {
+
+    }
+
+    MapArena::~MapArena()
+    {
+
+    }
+
+    MapArenaStatistics MapArena::GetStatistics() const
+    {
+        MapArenaStatistics statistics;
+        statistics.MapID = _mapID;
+        statistics.Items = _items.GetStatistics();
+        statistics.Containers = _containers.GetStatistics();
+        statistics.Units = _units.GetStatistics();
+        statistics.Players = _players.GetStatistics();
+        return statistics;
+    }
+}
@@ -0,0 +1,90 @@
+#pragma once
+
+#include "ObjectPool.hpp"
+#include "CGObject.hpp"
+#include "CGUnit.hpp"
+#include "CGPlayer.hpp"
+#include "CGItem.hpp"
+#include "CGContainer.hpp"
+
+#include <cstdint>
+#include <type_traits>
+
+namespace wowgm::game::entities
+{
+    struct MapArenaStatistics
+    {
+        uint32_t MapID;
+
+        ObjectPoolStatistics Items;
+        ObjectPoolStatistics Containers;
+        ObjectPoolStatistics Units;
+        ObjectPoolStatistics Players;
+
+        ObjectPoolStatistics GetTotal() const
+        {
+            ObjectPoolStatistics total;
+            total += Items;
+            total += Containers;
+            total += Units;
+            total += Players;
+            return total;
+        }
+    };
+
+    /**
+     * Owns every entity created while the client is on a given map instance.
+     *
+     * Entities are constructed in place inside typed pools. Leaving the map drops the whole arena,
+     * which returns every chunk to the system without visiting the objects themselves.
+     */
+    class MapArena final
+    {
+    public:
+        explicit MapArena(uint32_t mapID);
+        ~MapArena();
+
+        MapArena(MapArena&&) = delete;
+        MapArena(MapArena const&) = delete;
+
+        uint32_t GetMapID() const { return _mapID; }
+
+        template <typename T, typename... Args>
+        T* Create(Args&&... args)
+        {
+            return GetPool<T>().Construct(std::forward<Args>(args)...);
+        }
+
+        template <typename T>
+        void Destroy(T* object)
+        {
+            GetPool<T>().Destroy(object);
+        }
+
+        MapArenaStatistics GetStatistics() const;
+
+    private:
+        template <typename T>
+        auto GetPool() -> ObjectPool<T>&
+        {
+            if constexpr (std::is_same<T, CGItem>::value)
+                return _items;
+            else if constexpr (std::is_same<T, CGContainer>::value)
+                return _containers;
+            else if constexpr (std::is_same<T, CGUnit>::value)
+                return _units;
+            else
+            {
+                static_assert(std::is_same<T, CGPlayer>::value, "No pool is available for this entity type");
+                return _players;
+            }
+        }
+
+        uint32_t _mapID;
+
+        ObjectPool<CGItem> _items;
+        ObjectPool<CGContainer> _containers;
+        ObjectPool<CGUnit> _units;
+        ObjectPool<CGPlayer> _players;
+    };
+}
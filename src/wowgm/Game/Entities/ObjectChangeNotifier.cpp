@@ -0,0 +1,80 @@
+#include "ObjectChangeNotifier.hpp"
+#include "CGObject.hpp"
+
+#include <unordered_set>
+
+namespace wowgm::game::entities
+{
+    ObjectChangeNotifier* ObjectChangeNotifier::instance()
+    {
+        static ObjectChangeNotifier instance;
+        return &instance;
+    }
+
+    ObjectChangeNotifier::ObjectChangeNotifier()
+    {
+
+    }
+
+    auto ObjectChangeNotifier::Subscribe(TypeMask typeMask, std::initializer_list<DescriptorRange> ranges, Listener listener) -> SubscriptionID
+    {
+        Subscription subscription;
+        subscription.Types = typeMask;
+        subscription.Callback = std::move(listener);
+        for (DescriptorRange const& range : ranges)
+            range.AppendTo(subscription.Fields);
+
+        std::lock_guard<std::mutex> lock(_subscriptionsLock);
+        SubscriptionID subscriptionID = _nextSubscriptionID++;
+        _subscriptions.emplace(subscriptionID, std::move(subscription));
+        return subscriptionID;
+    }
+
+    void ObjectChangeNotifier::Unsubscribe(SubscriptionID subscriptionID)
+    {
+        std::lock_guard<std::mutex> lock(_subscriptionsLock);
+        _subscriptions.erase(subscriptionID);
+    }
+
+    void ObjectChangeNotifier::Flush(std::vector<CGObject*> const& changedObjects)
+    {
+        // Listeners may (un)subscribe from their callback, so don't call them with the lock held.
+        std::vector<Subscription> subscriptions;
+        {
+            std::lock_guard<std::mutex> lock(_subscriptionsLock);
+            subscriptions.reserve(_subscriptions.size());
+            for (auto&& itr : _subscriptions)
+                subscriptions.push_back(itr.second);
+        }
+
+        // The same object shows up once per update block that touched it.
+        std::vector<CGObject*> uniqueObjects;
+        uniqueObjects.reserve(changedObjects.size());
+        std::unordered_set<CGObject*> seenObjects;
+        for (CGObject* object : changedObjects)
+            if (object->GetChangedDescriptors().any() && seenObjects.insert(object).second)
+                uniqueObjects.push_back(object);
+
+        std::vector<CGObject*> matchingObjects;
+        for (Subscription const& subscription : subscriptions)
+        {
+            matchingObjects.clear();
+            for (CGObject* object : uniqueObjects)
+            {
+                if ((object->GetTypeMask() & subscription.Types) == 0)
+                    continue;
+
+                if ((object->GetChangedDescriptors() & subscription.Fields).none())
+                    continue;
+
+                matchingObjects.push_back(object);
+            }
+
+            if (!matchingObjects.empty())
+                subscription.Callback(matchingObjects);
+        }
+
+        for (CGObject* object : uniqueObjects)
+            object->ClearChangedDescriptors();
+    }
+}
@@ -0,0 +1,64 @@
+#pragma once
+
+#include "ObjectGuid.hpp"
+#include "DescriptorFields.hpp"
+
+#include <cstdint>
+#include <functional>
+#include <initializer_list>
+#include <map>
+#include <mutex>
+#include <vector>
+
+namespace wowgm::game::entities
+{
+    using namespace wowgm::game::structures;
+
+    class CGObject;
+
+    /**
+     * Dispatches descriptor changes to interested parties.
+     *
+     * Objects accumulate the descriptors written to them in a dirty mask. Once every update packet,
+     * each subscription is handed, in a single call, every object of the requested types whose dirty
+     * mask intersects the descriptor ranges it asked for. Dirty masks are cleared afterwards.
+     *
+     * Listeners are invoked on the network thread, and must not retain the object pointers.
+     */
+    class ObjectChangeNotifier final
+    {
+        ObjectChangeNotifier();
+
+    public:
+        using SubscriptionID = uint32_t;
+        using Listener = std::function<void(std::vector<CGObject*> const& /* changedObjects */)>;
+
+        static ObjectChangeNotifier* instance();
+
+        /**
+         * Registers a listener.
+         *
+         * @param[in] typeMask The object types the listener is interested in.
+         * @param[in] ranges   The descriptors the listener is interested in, i.e. { DESCRIPTOR_RANGE(CGUnitData, Level) }.
+         */
+        SubscriptionID Subscribe(TypeMask typeMask, std::initializer_list<DescriptorRange> ranges, Listener listener);
+        void Unsubscribe(SubscriptionID subscriptionID);
+
+        /// Notifies listeners of the changes accumulated by {@param changedObjects}, then clears them.
+        void Flush(std::vector<CGObject*> const& changedObjects);
+
+    private:
+        struct Subscription
+        {
+            TypeMask Types;
+            DescriptorMask Fields;
+            Listener Callback;
+        };
+
+        std::mutex _subscriptionsLock;
+        std::map<SubscriptionID, Subscription> _subscriptions;
+        SubscriptionID _nextSubscriptionID = 1;
+    };
+}
+
+#define sObjectChangeNotifier wowgm::game::entities::ObjectChangeNotifier::instance()
@@ -5,15 +5,28 @@
 #include "CGItem.hpp"
 #include "CGContainer.hpp"
 #include "CGPlayer.hpp"
+#include "MapArena.hpp"
+#include "MovementEngine.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <mutex>
+
+#include <shared/assert/assert.hpp>
+#include <shared/log/log.hpp>
+#include <shared/threading/epoch_manager.hpp>
 
 namespace wowgm::game::entities
 {
+    using namespace shared::threading;
+
     template <typename T>
     void ObjectHolder<T>::Insert(T* object)
     {
         std::unique_lock<std::shared_mutex> lock(*GetMutex());
 
         GetContainer()[object->GUID] = object;
+        GetDirty() = true;
     }
 
     template <typename T>
@@ -22,23 +35,71 @@ namespace wowgm::game::entities
         std::unique_lock<std::shared_mutex> lock(*GetMutex());
 
         GetContainer().erase(object->GUID);
+        GetDirty() = true;
     }
 
     template <typename T>
-    void ObjectHolder<T>::Remove(ObjectGuid const& guid)
+    T* ObjectHolder<T>::Remove(ObjectGuid const& guid)
     {
         std::unique_lock<std::shared_mutex> lock(*GetMutex());
 
-        GetContainer().erase(guid);
+        typename ContainerType::iterator itr = GetContainer().find(guid);
+        if (itr == GetContainer().end())
+            return nullptr;
+
+        T* object = itr->second;
+        GetContainer().erase(itr);
+        GetDirty() = true;
+        return object;
+    }
+
+    template <typename T>
+    void ObjectHolder<T>::Clear()
+    {
+        std::unique_lock<std::shared_mutex> lock(*GetMutex());
+
+        GetContainer().clear();
+        GetDirty() = true;
+    }
+
+    template <typename T>
+    void ObjectHolder<T>::Publish()
+    {
+        if (!GetDirty().exchange(false))
+            return;
+
+        SnapshotType* snapshot = new SnapshotType();
+        {
+            std::shared_lock<std::shared_mutex> lock(*GetMutex());
+
+            snapshot->reserve(GetContainer().size());
+            for (auto&& itr : GetContainer())
+                snapshot->emplace_back(itr.first, itr.second);
+        }
+
+        std::sort(snapshot->begin(), snapshot->end(), [](auto const& left, auto const& right) {
+            return left.first.GetRawValue() < right.first.GetRawValue();
+        });
+
+        SnapshotType const* previous = GetSnapshot().exchange(snapshot);
+        if (previous != nullptr)
+            epoch_manager::instance()->retire([previous]() { delete previous; });
     }
 
     template <typename T>
     T* ObjectHolder<T>::Find(ObjectGuid guid)
     {
-        std::shared_lock<std::shared_mutex> lock(*GetMutex());
+        epoch_guard guard;
 
-        typename ContainerType::iterator itr = GetContainer().find(guid);
-        return (itr != GetContainer().end()) ? itr->second : nullptr;
+        SnapshotType const* snapshot = GetSnapshot().load(std::memory_order_acquire);
+        if (snapshot == nullptr)
+            return nullptr;
+
+        auto itr = std::lower_bound(snapshot->begin(), snapshot->end(), guid.GetRawValue(), [](auto const& entry, uint64_t rawValue) {
+            return entry.first.GetRawValue() < rawValue;
+        });
+
+        return (itr != snapshot->end() && itr->first == guid) ? itr->second : nullptr;
     }
 
     template <typename T>
@@ -55,6 +116,20 @@ namespace wowgm::game::entities
         return _objectMap;
     }
 
+    template <typename T>
+    auto ObjectHolder<T>::GetSnapshot() -> std::atomic<SnapshotType const*>&
+    {
+        static std::atomic<SnapshotType const*> _snapshot(nullptr);
+        return _snapshot;
+    }
+
+    template <typename T>
+    std::atomic<bool>& ObjectHolder<T>::GetDirty()
+    {
+        static std::atomic<bool> _dirty(false);
+        return _dirty;
+    }
+
     template class ObjectHolder<CGItem>;
     template class ObjectHolder<CGContainer>;
     template class ObjectHolder<CGUnit>;
@@ -62,6 +137,87 @@ namespace wowgm::game::entities
 
     namespace ObjectAccessor
     {
+        namespace
+        {
+            std::unique_ptr<MapArena> s_arena;
+
+            // Written by the network thread, read from everywhere.
+            std::mutex s_localPlayerLock;
+            ObjectGuid s_localPlayer;
+
+            template <typename T>
+            void DestroyImpl(ObjectGuid const& guid)
+            {
+                T* object = ObjectHolder<T>::Remove(guid);
+                if (object == nullptr)
+                    return;
+
+                sMovementEngine->Stop(guid);
+
+                // Other threads may have looked the object up before it was unregistered.
+                MapArena* arena = s_arena.get();
+                if (arena != nullptr)
+                    epoch_manager::instance()->retire([arena, object]() { arena->Destroy(object); });
+            }
+        }
+
+        template <typename T>
+        T* Allocate(CClientObjCreate const& createBlock)
+        {
+            static_assert(!std::is_same<CGObject, T>::value);
+
+            if (s_arena == nullptr)
+                s_arena = std::make_unique<MapArena>(0xFFFFFFFFu);
+
+            return s_arena->Create<T>(createBlock);
+        }
+
+        template CGItem* Allocate<CGItem>(CClientObjCreate const&);
+        template CGContainer* Allocate<CGContainer>(CClientObjCreate const&);
+        template CGUnit* Allocate<CGUnit>(CClientObjCreate const&);
+        template CGPlayer* Allocate<CGPlayer>(CClientObjCreate const&);
+
+        template <typename T>
+        T* Create(CClientObjCreate const& createBlock)
+        {
+            T* object = Allocate<T>(createBlock);
+            Register(object);
+            return object;
+        }
+
+        template CGItem* Create<CGItem>(CClientObjCreate const&);
+        template CGContainer* Create<CGContainer>(CClientObjCreate const&);
+        template CGUnit* Create<CGUnit>(CClientObjCreate const&);
+        template CGPlayer* Create<CGPlayer>(CClientObjCreate const&);
+
+        void Register(CGObject* object)
+        {
+            // Never leak whatever was previously known under this GUID.
+            switch (object->GUID.GetTypeId())
+            {
+                case TYPEID_UNIT:
+                    DestroyImpl<CGUnit>(object->GUID);
+                    ObjectHolder<CGUnit>::Insert(static_cast<CGUnit*>(object));
+                    break;
+                case TYPEID_ITEM:
+                    DestroyImpl<CGItem>(object->GUID);
+                    ObjectHolder<CGItem>::Insert(static_cast<CGItem*>(object));
+                    break;
+                case TYPEID_CONTAINER:
+                    DestroyImpl<CGContainer>(object->GUID);
+                    ObjectHolder<CGContainer>::Insert(static_cast<CGContainer*>(object));
+                    break;
+                case TYPEID_PLAYER:
+                    DestroyImpl<CGPlayer>(object->GUID);
+                    ObjectHolder<CGPlayer>::Insert(static_cast<CGPlayer*>(object));
+                    break;
+                default:
+                    // Allocate only constructs the types above; the arena pool of anything else is unknown.
+                    BOOST_ASSERT_MSG(false, "Registering an entity of a type that can not be allocated");
+                    break;
+            }
+        }
+
         template <typename T>
         T* GetObject(ObjectGuid const& guid)
         {
@@ -96,16 +252,16 @@ namespace wowgm::game::entities
             switch (objectGuid.GetTypeId())
             {
                 case TYPEID_UNIT:
-                    ObjectHolder<CGUnit>::Remove(objectGuid);
+                    DestroyImpl<CGUnit>(objectGuid);
                     break;
                 case TYPEID_ITEM:
-                    ObjectHolder<CGItem>::Remove(objectGuid);
+                    DestroyImpl<CGItem>(objectGuid);
                     break;
                 case TYPEID_CONTAINER:
-                    ObjectHolder<CGContainer>::Remove(objectGuid);
+                    DestroyImpl<CGContainer>(objectGuid);
                     break;
                 case TYPEID_PLAYER:
-                    ObjectHolder<CGPlayer>::Remove(objectGuid);
+                    DestroyImpl<CGPlayer>(objectGuid);
                     break;
             }
         }
@@ -116,9 +272,77 @@ namespace wowgm::game::entities
                 Destroy(object->GUID);
         }
 
+        void Publish()
+        {
+            ObjectHolder<CGItem>::Publish();
+            ObjectHolder<CGContainer>::Publish();
+            ObjectHolder<CGUnit>::Publish();
+            ObjectHolder<CGPlayer>::Publish();
+
+            // Reclaimers touch the arena, which only the network thread may do.
+            epoch_manager::instance()->collect();
+        }
+
+        void ResetArena(uint32_t mapID)
+        {
+            ObjectHolder<CGItem>::Clear();
+            ObjectHolder<CGContainer>::Clear();
+            ObjectHolder<CGUnit>::Clear();
+            ObjectHolder<CGPlayer>::Clear();
+
+            sMovementEngine->Clear();
+
+            if (s_arena != nullptr)
+            {
+                MapArenaStatistics statistics = s_arena->GetStatistics();
+                ObjectPoolStatistics total = statistics.GetTotal();
+
+                LOG_INFO("Releasing arena for map {}: {} objects in {} chunks (occupancy {:.1f}%, fragmentation {:.1f}%)",
+                    statistics.MapID, total.Occupied, total.ChunkCount,
+                    total.GetOccupancy() * 100.0f, total.GetFragmentation() * 100.0f);
+
+                // Unpublish every entity first; the arena goes once no reader can still see any of them.
+                ObjectHolder<CGItem>::Publish();
+                ObjectHolder<CGContainer>::Publish();
+                ObjectHolder<CGUnit>::Publish();
+                ObjectHolder<CGPlayer>::Publish();
+
+                MapArena* previous = s_arena.release();
+                epoch_manager::instance()->retire([previous]() { delete previous; });
+            }
+
+            s_arena = std::make_unique<MapArena>(mapID);
+            Publish();
+        }
+
+        MapArena* GetArena()
+        {
+            return s_arena.get();
+        }
+
+        MapArenaStatistics GetArenaStatistics()
+        {
+            if (s_arena == nullptr)
+                return MapArenaStatistics{ 0xFFFFFFFFu };
+
+            return s_arena->GetStatistics();
+        }
+
         CGPlayer* GetLocalPlayer()
         {
-            return GetObject<CGPlayer>(s_localPlayer);
+            return GetObject<CGPlayer>(GetLocalPlayerGUID());
+        }
+
+        ObjectGuid GetLocalPlayerGUID()
+        {
+            std::lock_guard<std::mutex> lock(s_localPlayerLock);
+            return s_localPlayer;
+        }
+
+        void SetLocalPlayer(ObjectGuid const& guid)
+        {
+            std::lock_guard<std::mutex> lock(s_localPlayerLock);
+            s_localPlayer = guid;
         }
     }
 }
@@ -2,8 +2,15 @@
 
 #include "ObjectGuid.hpp"
 #include "CGObject.hpp"
+#include "CClientObjCreate.hpp"
+#include "MapArena.hpp"
 
+#include <extstd/containers/flat_hash_map.hpp>
+
+#include <atomic>
 #include <shared_mutex>
+#include <utility>
+#include <vector>
 #include <type_traits>
 
 // WTF, stop this shit please
@@ -33,6 +40,13 @@ namespace wowgm::game::entities
         template <> struct typeid_trait<TYPEID_AREATRIGGER> { using type = CGAreaTrigger; };
     }
 
+    /**
+     * Known entities of a given type.
+     *
+     * The network thread edits a private container, and publishes an immutable, sorted copy of it
+     * with {@link Publish}. Lookups only ever go through the published copy, without locking; copies
+     * that are replaced are reclaimed once no reader can still be looking at them.
+     */
     template <typename T>
     class ObjectHolder final
     {
@@ -41,23 +55,41 @@ namespace wowgm::game::entities
         ObjectHolder() { }
 
     public:
-        using ContainerType = std::unordered_map<ObjectGuid, T*>;
+        using ContainerType = extstd::containers::flat_hash_map<ObjectGuid, T*>;
+        using SnapshotType = std::vector<std::pair<ObjectGuid, T*>>;
 
+        /// The private container. Network thread only, under {@link GetMutex}.
         static ContainerType& GetContainer();
 
         static void Insert(T* object);
 
         static void Remove(T* object);
 
-        static void Remove(ObjectGuid const& guid);
+        static T* Remove(ObjectGuid const& guid);
+
+        static void Clear();
 
+        /// Makes every edit since the last call visible to {@link Find}.
+        static void Publish();
+
+        /// Lock-free lookup in the published container. The result is only valid while the caller holds an epoch_guard.
         static T* Find(ObjectGuid guid);
 
         static std::shared_mutex* GetMutex();
+
+    private:
+        static std::atomic<SnapshotType const*>& GetSnapshot();
+        static std::atomic<bool>& GetDirty();
     };
 
     namespace ObjectAccessor
     {
+        /**
+         * Looks up an entity among those published by the network thread.
+         *
+         * Destroyed entities are only reclaimed once no thread pinning an epoch can still see them: callers outside
+         * of the network thread must hold a shared::threading::epoch_guard for as long as they use the result.
+         */
         template <typename T>
         T* GetObject(ObjectGuid const& guid);
 
@@ -66,11 +98,34 @@ namespace wowgm::game::entities
             return GetObject<typename typeid_trait<Type>::type>(guid);
         }
 
+        /// Constructs a new entity inside the current map arena, without registering it.
+        template <typename T>
+        T* Allocate(CClientObjCreate const& createBlock);
+
+        /// Makes an allocated entity visible to lookups, replacing any entity known under the same GUID.
+        void Register(CGObject* object);
+
+        /// Constructs a new entity inside the current map arena and registers it.
+        template <typename T>
+        T* Create(CClientObjCreate const& createBlock);
+
+        /// Makes every entity registered or destroyed since the last call visible to GetObject, and reclaims what is safe to reclaim.
+        void Publish();
+
+        /// Unregisters an entity. Its memory is reclaimed once no reader can still see it.
         void Destroy(ObjectGuid const& objectGuid);
 
         void Destroy(CGObject* object);
 
+        /// Forgets every known entity and starts a fresh arena for the given map.
+        void ResetArena(uint32_t mapID);
+
+        MapArena* GetArena();
+
+        MapArenaStatistics GetArenaStatistics();
+
         CGPlayer* GetLocalPlayer();
-        static ObjectGuid s_localPlayer;
+        ObjectGuid GetLocalPlayerGUID();
+        void SetLocalPlayer(ObjectGuid const& guid);
     }
 }
@@ -0,0 +1,134 @@
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <utility>
+#include <vector>
+
+namespace wowgm::game::entities
+{
+    struct ObjectPoolStatistics
+    {
+        size_t ChunkCount = 0;
+        size_t Capacity = 0;  // Slots available across all chunks
+        size_t Touched = 0;   // Slots that have held an object at least once
+        size_t Occupied = 0;  // Slots currently holding a live object
+
+        /// Ratio of live objects to allocated slots.
+        float GetOccupancy() const
+        {
+            return Capacity == 0 ? 0.0f : float(Occupied) / float(Capacity);
+        }
+
+        /// Ratio of recycled, currently empty slots to every slot ever handed out.
+        float GetFragmentation() const
+        {
+            return Touched == 0 ? 0.0f : float(Touched - Occupied) / float(Touched);
+        }
+
+        ObjectPoolStatistics& operator += (ObjectPoolStatistics const& other)
+        {
+            ChunkCount += other.ChunkCount;
+            Capacity += other.Capacity;
+            Touched += other.Touched;
+            Occupied += other.Occupied;
+            return *this;
+        }
+    };
+
+    /**
+     * A typed pool that constructs objects in place inside fixed-size chunks.
+     *
+     * Destroyed slots are threaded onto an intrusive free list and handed back out by the next
+     * construction, so a zone-in burst only hits the system allocator once every {@param ChunkSize} objects.
+     *
+     * This class is not thread-safe.
+     */
+    template <typename T, size_t ChunkSize = 256>
+    class ObjectPool final
+    {
+        static_assert(ChunkSize > 0);
+
+        union Slot
+        {
+            Slot* Next;
+            alignas(T) uint8_t Storage[sizeof(T)];
+        };
+
+    public:
+        ObjectPool() { }
+        ~ObjectPool() { Release(); }
+
+        ObjectPool(ObjectPool&&) = delete;
+        ObjectPool(ObjectPool const&) = delete;
+
+        template <typename... Args>
+        T* Construct(Args&&... args)
+        {
+            Slot* slot = _freeList;
+            if (slot != nullptr)
+                _freeList = slot->Next;
+            else
+            {
+                if (_chunks.empty() || _chunkCursor == ChunkSize)
+                {
+                    _chunks.emplace_back(new Slot[ChunkSize]);
+                    _chunkCursor = 0;
+                }
+
+                slot = &_chunks.back()[_chunkCursor++];
+                ++_touched;
+            }
+
+            ++_occupied;
+            return new (slot->Storage) T(std::forward<Args>(args)...);
+        }
+
+        void Destroy(T* object)
+        {
+            if (object == nullptr)
+                return;
+
+            object->~T();
+
+            Slot* slot = reinterpret_cast<Slot*>(object);
+            slot->Next = _freeList;
+            _freeList = slot;
+
+            --_occupied;
+        }
+
+        /**
+         * Drops every chunk at once. Live objects are not destructed: entities only own trivially
+         * destructible descriptor blocks, so there is nothing to run per object.
+         */
+        void Release()
+        {
+            _chunks.clear();
+            _freeList = nullptr;
+            _chunkCursor = 0;
+            _touched = 0;
+            _occupied = 0;
+        }
+
+        ObjectPoolStatistics GetStatistics() const
+        {
+            ObjectPoolStatistics statistics;
+            statistics.ChunkCount = _chunks.size();
+            statistics.Capacity = _chunks.size() * ChunkSize;
+            statistics.Touched = _touched;
+            statistics.Occupied = _occupied;
+            return statistics;
+        }
+
+    private:
+        std::vector<std::unique_ptr<Slot[]>> _chunks;
+        Slot* _freeList = nullptr;
+
+        size_t _chunkCursor = 0;
+        size_t _touched = 0;
+        size_t _occupied = 0;
+    };
+}
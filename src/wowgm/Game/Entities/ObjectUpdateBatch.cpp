@@ -0,0 +1,186 @@
+#include "ObjectUpdateBatch.hpp"
+#include "ObjectMgr.hpp"
+
+#include "CGObject.hpp"
+#include "CGUnit.hpp"
+#include "CGItem.hpp"
+#include "CGContainer.hpp"
+#include "CGPlayer.hpp"
+
+#include <shared/threading/thread_pool.hpp>
+#include <extstd/containers/flat_hash_map.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <future>
+#include <memory>
+#include <thread>
+
+namespace wowgm::game::entities
+{
+    using namespace shared::threading;
+
+    namespace
+    {
+        std::atomic<size_t> s_parallelThreshold(0);
+
+        size_t GetWorkerCount()
+        {
+            return std::max(std::thread::hardware_concurrency(), 2u);
+        }
+
+        thread_pool& GetWorkerPool()
+        {
+            static thread_pool pool(GetWorkerCount());
+            return pool;
+        }
+
+        size_t GetPartition(ObjectGuid const& guid, size_t partitionCount)
+        {
+            // Counters are sequential, spread them before taking the modulo.
+            uint64_t hash = guid.GetRawValue() * 0x9E3779B97F4A7C15uLL;
+            return size_t(hash >> 32) % partitionCount;
+        }
+
+        CGObject* Allocate(CClientObjCreate const& block)
+        {
+            switch (block.GUID.GetTypeId())
+            {
+                case TYPEID_UNIT:
+                    return ObjectAccessor::Allocate<CGUnit>(block);
+                case TYPEID_ITEM:
+                    return ObjectAccessor::Allocate<CGItem>(block);
+                case TYPEID_CONTAINER:
+                    return ObjectAccessor::Allocate<CGContainer>(block);
+                case TYPEID_PLAYER:
+                    return ObjectAccessor::Allocate<CGPlayer>(block);
+                default:
+                    // Other object types have no allocator yet.
+                    return nullptr;
+            }
+        }
+    }
+
+    ObjectUpdateBatch::ObjectUpdateBatch(std::vector<CClientObjCreate>& updates)
+    {
+        _operations.reserve(updates.size());
+
+        for (CClientObjCreate& block : updates)
+        {
+            switch (block.UpdateType)
+            {
+                case UpdateType::Values:
+                    _operations.push_back({ &block, nullptr, nullptr });
+                    break;
+                case UpdateType::CreateObject1:
+                case UpdateType::CreateObject2:
+                    if (CGObject* created = Allocate(block))
+                        _operations.push_back({ &block, created, nullptr });
+                    break;
+                default: // Destroys are handled by the caller before the batch is applied.
+                    break;
+            }
+        }
+    }
+
+    void ObjectUpdateBatch::Apply()
+    {
+        size_t threshold = GetParallelThreshold();
+        if (threshold == 0 || _operations.size() < threshold)
+        {
+            std::vector<size_t> partition(_operations.size());
+            for (size_t i = 0; i < partition.size(); ++i)
+                partition[i] = i;
+
+            ApplyPartition(partition);
+        }
+        else
+        {
+            size_t partitionCount = GetWorkerCount() * 2;
+
+            // Partitions hold indices so that workers write the resolved target to distinct operations.
+            std::vector<std::vector<size_t>> partitions(partitionCount);
+            for (size_t i = 0; i < _operations.size(); ++i)
+                partitions[GetPartition(_operations[i].Block->GUID, partitionCount)].push_back(i);
+
+            std::vector<std::future<void>> tasks;
+            tasks.reserve(partitionCount);
+            for (std::vector<size_t> const& partition : partitions)
+            {
+                if (partition.empty())
+                    continue;
+
+                tasks.push_back(GetWorkerPool().submit([this, &partition]() -> void {
+                    ApplyPartition(partition);
+                }));
+            }
+
+            for (std::future<void>& task : tasks)
+                task.get();
+        }
+
+        for (Operation const& operation : _operations)
+            if (operation.Created != nullptr)
+                ObjectAccessor::Register(operation.Created);
+
+        ObjectAccessor::Publish();
+    }
+
+    void ObjectUpdateBatch::ApplyPartition(std::vector<size_t> const& partition)
+    {
+        // Objects created earlier in this packet are not registered yet.
+        extstd::containers::flat_hash_map<ObjectGuid, CGObject*> created;
+
+        for (size_t index : partition)
+        {
+            Operation& operation = _operations[index];
+
+            CGObject* target = operation.Created;
+            if (target != nullptr)
+                created[operation.Block->GUID] = target;
+            else
+            {
+                auto itr = created.find(operation.Block->GUID);
+                if (itr != created.end())
+                    target = itr->second;
+                else
+                    target = ObjectAccessor::GetObject<CGObject>(operation.Block->GUID);
+            }
+
+            if (target != nullptr)
+                target->UpdateDescriptors(operation.Block->Values);
+
+            operation.Target = target;
+        }
+    }
+
+    std::vector<CGObject*> ObjectUpdateBatch::GetChangedObjects() const
+    {
+        std::vector<CGObject*> changedObjects;
+        changedObjects.reserve(_operations.size());
+
+        for (Operation const& operation : _operations)
+        {
+            if (operation.Target == nullptr)
+                continue;
+
+            // Objects replaced by a later creation block of the same packet have been recycled.
+            if (ObjectAccessor::GetObject<CGObject>(operation.Block->GUID) != operation.Target)
+                continue;
+
+            changedObjects.push_back(operation.Target);
+        }
+
+        return changedObjects;
+    }
+
+    void ObjectUpdateBatch::SetParallelThreshold(size_t blockCount)
+    {
+        s_parallelThreshold = blockCount;
+    }
+
+    size_t ObjectUpdateBatch::GetParallelThreshold()
+    {
+        return s_parallelThreshold;
+    }
+}
@@ -0,0 +1,54 @@
+#pragma once
+
+#include "ObjectGuid.hpp"
+#include "CClientObjCreate.hpp"
+
+#include <cstdint>
+#include <cstddef>
+#include <vector>
+
+namespace wowgm::game::entities
+{
+    using namespace wowgm::game::structures;
+
+    class CGObject;
+
+    /**
+     * Applies the update blocks of a single SMSG_UPDATE_OBJECT.
+     *
+     * Application happens in three steps:
+     *   1. Objects for creation blocks are allocated in packet order, but not registered yet.
+     *   2. Descriptor blocks are partitioned by GUID, and every partition is replayed in packet order.
+     *      Partitions never share a GUID, so they can run on the worker pool.
+     *   3. Created objects are registered in packet order, replacing whatever was known under their GUID,
+     *      and published.
+     *
+     * Allocation and registration being serial keeps the final state identical to a serial application.
+     */
+    class ObjectUpdateBatch final
+    {
+        struct Operation
+        {
+            CClientObjCreate* Block;
+            CGObject* Created; // nullptr for value updates.
+            CGObject* Target;  // Object the descriptors were written to, resolved during application.
+        };
+
+    public:
+        explicit ObjectUpdateBatch(std::vector<CClientObjCreate>& updates);
+
+        void Apply();
+
+        /// Registered objects that received descriptors from this batch, in packet order. Only valid after {@link Apply}.
+        std::vector<CGObject*> GetChangedObjects() const;
+
+        /// Batches with at least this many blocks are applied on the worker pool. Zero disables parallel application.
+        static void SetParallelThreshold(size_t blockCount);
+        static size_t GetParallelThreshold();
+
+    private:
+        void ApplyPartition(std::vector<size_t> const& partition);
+
+        std::vector<Operation> _operations;
+    };
+}
@@ -0,0 +1,85 @@
+#include "WorldSnapshot.hpp"
+#include "ObjectMgr.hpp"
+
+#include "CGUnit.hpp"
+#include "CGPlayer.hpp"
+#include "MovementEngine.hpp"
+
+#include <extstd/threading/triple_buffer.hpp>
+
+#include <mutex>
+#include <shared_mutex>
+
+namespace wowgm::game::entities
+{
+    namespace
+    {
+        extstd::threading::triple_buffer<WorldSnapshot> s_snapshots;
+        uint64_t s_sequence = 0;
+
+        void Capture(CGUnit const* unit, TypeID type, EntitySnapshot& snapshot)
+        {
+            CGUnitData const& unitData = unit->GetUnitData();
+
+            snapshot.GUID = unit->GUID;
+            snapshot.Type = type;
+            snapshot.Position = unit->GetPosition();
+            snapshot.Entry = unit->Entry;
+            snapshot.Level = unitData.Level;
+            snapshot.FactionID = unitData.FactionID;
+            snapshot.DisplayID = unitData.DisplayID;
+            snapshot.Target = unitData.Target;
+        }
+
+        template <typename T>
+        void CaptureAll(TypeID type, WorldSnapshot& snapshot, ObjectGuid const& localPlayer)
+        {
+            std::shared_lock<std::shared_mutex> lock(*ObjectHolder<T>::GetMutex());
+
+            for (auto&& itr : ObjectHolder<T>::GetContainer())
+            {
+                snapshot.Units.emplace_back();
+                Capture(itr.second, type, snapshot.Units.back());
+
+                if (itr.first == localPlayer)
+                {
+                    snapshot.HasLocalPlayer = true;
+                    snapshot.LocalPlayer = snapshot.Units.back();
+                }
+            }
+        }
+    }
+
+    namespace WorldSnapshots
+    {
+        void Publish()
+        {
+            WorldSnapshot& snapshot = s_snapshots.write_buffer();
+
+            // The buffer holds a stale snapshot; reuse its storage.
+            snapshot.Sequence = ++s_sequence;
+            MapArena const* arena = ObjectAccessor::GetArena();
+            snapshot.MapID = arena != nullptr ? arena->GetMapID() : 0xFFFFFFFFu;
+            snapshot.HasLocalPlayer = false;
+            snapshot.LocalPlayer = EntitySnapshot();
+            snapshot.Units.clear();
+
+            ObjectGuid localPlayer = ObjectAccessor::GetLocalPlayerGUID();
+
+            // Positions are extrapolated on the updater thread.
+            std::unique_lock<std::mutex> positionsLock = sMovementEngine->LockPositions();
+            snapshot.MovementTick = sMovementEngine->CapturePositions();
+            CaptureAll<CGUnit>(TYPEID_UNIT, snapshot, localPlayer);
+            CaptureAll<CGPlayer>(TYPEID_PLAYER, snapshot, localPlayer);
+            positionsLock.unlock();
+
+            s_snapshots.publish();
+        }
+
+        WorldSnapshot const& Acquire()
+        {
+            s_snapshots.acquire();
+            return s_snapshots.read_buffer();
+        }
+    }
+}
@@ -0,0 +1,56 @@
+#pragma once
+
+#include "ObjectGuid.hpp"
+#include "C3Vector.hpp"
+
+#include <cstdint>
+#include <vector>
+
+namespace wowgm::game::entities
+{
+    using namespace wowgm::game::structures;
+
+    /// Copy of the state of a unit or player that readers outside of the network thread care about.
+    struct EntitySnapshot
+    {
+        ObjectGuid GUID;
+        TypeID Type = TYPEID_OBJECT;
+        C3Vector Position;
+        uint32_t Entry = 0;
+        uint32_t Level = 0;
+        uint32_t FactionID = 0;
+        uint32_t DisplayID = 0;
+        ObjectGuid Target;
+    };
+
+    /// Immutable view of the world, as of the end of an update packet.
+    struct WorldSnapshot
+    {
+        uint64_t Sequence = 0; // Zero until the first snapshot is published.
+        uint32_t MapID = 0xFFFFFFFFu;
+        uint64_t MovementTick = 0; // Last movement engine tick whose positions are included.
+
+        bool HasLocalPlayer = false;
+        EntitySnapshot LocalPlayer;
+
+        std::vector<EntitySnapshot> Units; // Units and players, in no particular order.
+    };
+
+    /**
+     * Triple-buffered world snapshots.
+     *
+     * The network thread publishes a snapshot once it is done handling a packet that changes entities;
+     * the render thread acquires the most recent one once per frame. Neither side takes a lock to do so,
+     * and the render thread always sees a consistent frame, regardless of how fast updates come in.
+     *
+     * There can only be one producer (the network thread) and one consumer (the render thread).
+     */
+    namespace WorldSnapshots
+    {
+        /// Copies the current state of every known unit and player into the next snapshot and publishes it.
+        void Publish();
+
+        /// Returns the most recently published snapshot. Stays valid until the next call.
+        WorldSnapshot const& Acquire();
+    }
+}
@@ -3,11 +3,13 @@
 #include <shared/assert/assert.hpp>
 #include <shared/log/log.hpp>
 
+#include <atomic>
 #include <sstream>
 #include <cstring>
 #include <string_view>
 
 #include <shared/filesystem/mpq_file_system.hpp>
+#include <shared/filesystem/mpq_file_loader.hpp>
 
 #ifdef min
 #undef min
@@ -22,14 +24,27 @@ namespace wowgm::game::geometry
     constexpr static const float CHUNK_SIZE = TILE_SIZE / 16.0f;
     constexpr static const float UNIT_SIZE  = CHUNK_SIZE / 8.0f;
 
-    /*  --------------------------------- ADT TILE --------------------------------- */
-    MapChunk::MapChunk(uint32_t x, uint32_t y, const std::string& directoryName)
+    namespace
     {
-        auto manager = mpq_file_system::Instance();
+        /// Files of a tile, filled in by the loader as they arrive.
+        struct PendingTile
+        {
+            std::array<std::shared_ptr<mpq_file>, 3> Files;
+            std::atomic<uint32_t> RemainingFiles{ 3 };
+        };
+    }
 
+    /*  --------------------------------- ADT TILE --------------------------------- */
+    std::array<std::string, 3> MapChunk::GetFilePaths(uint32_t x, uint32_t y, const std::string& directoryName)
+    {
         std::stringstream filePath;
         filePath << "world/maps/" << directoryName << '/' << directoryName << '_' << x << '_' << y;
 
+        return { filePath.str() + ".adt", filePath.str() + "_obj0.adt", filePath.str() + "_tex0.adt" };
+    }
+
+    MapChunk::MapChunk(uint32_t x, uint32_t y, std::array<std::shared_ptr<mpq_file>, 3> const& files)
+    {
         _boundingBox.Minimum.X = x * CHUNK_SIZE;
         _boundingBox.Minimum.Y = y * CHUNK_SIZE;
         _boundingBox.Maximum.X = _boundingBox.Minimum.X + CHUNK_SIZE;
@@ -38,16 +53,12 @@ namespace wowgm::game::geometry
         // Marker for validity, set as long as we don't find vertices
         _boundingBox.Minimum.Z = std::numeric_limits<float>::min();
 
-        std::shared_ptr<mpq_file> rootFile = manager->OpenFile(filePath.str() + ".adt");
-        std::shared_ptr<mpq_file> objFile = manager->OpenFile(filePath.str() + "_obj0.adt");
-        std::shared_ptr<mpq_file> texFile = manager->OpenFile(filePath.str() + "_tex0.adt");
-
-        if (!rootFile || !objFile || !texFile)
-            return;
+        for (std::shared_ptr<mpq_file> const& file : files)
+            if (!file)
+                return;
 
-        ParseFile(rootFile);
-        ParseFile(objFile);
-        ParseFile(texFile);
+        for (std::shared_ptr<mpq_file> const& file : files)
+            ParseFile(file);
     }
 
     MapChunk::~MapChunk()
@@ -254,26 +265,96 @@ namespace wowgm::game::geometry
 
     /*  --------------------------------- ADT MAP --------------------------------- */
 
-    ADT::ADT(const std::string& directoryName)
+    ADT::ADT(const std::string& directoryName, C3Vector const& position) : _loadedTiles(std::make_shared<loaded_tiles>())
     {
+        mpq_file_system* fileSystem = mpq_file_system::Instance();
+        mpq_file_loader* loader = mpq_file_loader::Instance();
+
         for (uint32_t x = 0; x < 64; ++x)
         {
             for (uint32_t y = 0; y < 64; ++y)
             {
-                MapChunk* newChunk = new MapChunk(x, y, directoryName);
-                if (newChunk->HasGeometry())
-                    _chunks.push_back(newChunk);
-                else
-                    delete newChunk;
+                std::array<std::string, 3> filePaths = MapChunk::GetFilePaths(x, y, directoryName);
+
+                // Most of the grid is empty, which the file index tells without reading anything.
+                if (!fileSystem->FileExists(filePaths[0]))
+                    continue;
+
+                float deltaX = (x + 0.5f) * MapChunk::CHUNK_SIZE - position.X;
+                float deltaY = (y + 0.5f) * MapChunk::CHUNK_SIZE - position.Y;
+                float priority = deltaX * deltaX + deltaY * deltaY;
+
+                auto tile = std::make_shared<PendingTile>();
+                for (uint32_t i = 0; i < 3; ++i)
+                {
+                    _requests.push_back(loader->Load(filePaths[i], priority, [tile, i, x, y, loadedTiles = _loadedTiles](std::shared_ptr<mpq_file> const& file) {
+                        tile->Files[i] = file;
+
+                        // The last file to arrive parses the tile, on the loader thread.
+                        if (--tile->RemainingFiles != 0)
+                            return;
+
+                        MapChunk* newChunk = new MapChunk(x, y, tile->Files);
+                        tile->Files.fill(nullptr);
+
+                        if (!newChunk->HasGeometry())
+                        {
+                            delete newChunk;
+                            return;
+                        }
+
+                        std::lock_guard<std::mutex> lock(loadedTiles->lock);
+                        loadedTiles->chunks.push_back(newChunk);
+                    }));
+                }
             }
         }
     }
 
     ADT::~ADT()
     {
+        Cancel();
+
+        // Loads being read run their callback before resolving.
+        for (mpq_load_request const& request : _requests)
+            request.GetFuture().wait();
+
         for (MapChunk* itr : _chunks)
             delete itr;
 
         _chunks.clear();
     }
+
+    void ADT::Update()
+    {
+        std::vector<MapChunk*> loadedChunks;
+
+        {
+            std::lock_guard<std::mutex> lock(_loadedTiles->lock);
+            loadedChunks.swap(_loadedTiles->chunks);
+        }
+
+        _chunks.insert(_chunks.end(), loadedChunks.begin(), loadedChunks.end());
+    }
+
+    void ADT::Cancel()
+    {
+        for (mpq_load_request& request : _requests)
+            request.Cancel();
+    }
+
+    bool ADT::IsLoading() const
+    {
+        for (mpq_load_request const& request : _requests)
+            if (request.GetFuture().wait_for(std::chrono::seconds(0)) != std::future_status::ready)
+                return true;
+
+        return false;
+    }
+
+    ADT::loaded_tiles::~loaded_tiles()
+    {
+        for (MapChunk* itr : chunks)
+            delete itr;
+    }
 }
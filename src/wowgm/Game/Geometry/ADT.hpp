@@ -8,8 +8,11 @@
 #include <string>
 #include <vector>
 #include <array>
+#include <memory>
+#include <mutex>
 
 #include <shared/filesystem/mpq_file_system.hpp>
+#include <shared/filesystem/mpq_file_loader.hpp>
 
 namespace wowgm::game::geometry
 {
@@ -110,7 +113,8 @@ namespace wowgm::game::geometry
     {
     public:
 
-        MapChunk(uint32_t x, uint32_t y, const std::string& directoryName);
+        /// Parses the tile from its root, object and texture files, in that order.
+        MapChunk(uint32_t x, uint32_t y, std::array<std::shared_ptr<mpq_file>, 3> const& files);
         ~MapChunk();
 
         MapChunk(MapChunk&&) = delete;
@@ -118,6 +122,9 @@ namespace wowgm::game::geometry
 
         constexpr static const float CHUNK_SIZE = 533.33333f;
 
+        /// Paths of the root, object and texture files of a tile.
+        static std::array<std::string, 3> GetFilePaths(uint32_t x, uint32_t y, const std::string& directoryName);
+
         CAaBox const& GetBoundingBox() const;
 
         void Render() const;
@@ -150,10 +157,14 @@ namespace wowgm::game::geometry
     };
 
 
+    /// Every tile of a map. Tiles load in the background, nearest to the player first.
     class ADT
     {
     public:
-        ADT(const std::string& directoryName);
+        /// Queues the tiles of the map, nearest to {@param position} first, and returns without waiting for any.
+        ADT(const std::string& directoryName, C3Vector const& position);
+
+        /// Cancels the tiles still queued and waits for the ones being read, whose callbacks may still be running.
         ~ADT();
 
         ADT(ADT&&) = delete;
@@ -165,7 +176,28 @@ namespace wowgm::game::geometry
         iterator begin() { return _chunks.begin(); }
         const_iterator begin() const { return _chunks.begin(); }
 
+        /// Adds the tiles loaded since the last call. Must be called from the thread iterating the tiles.
+        void Update();
+
+        /// Drops the tiles still queued, for when the player has moved on. Tiles being read still finish.
+        void Cancel();
+
+        /// Whether a tile is still queued or being read, in which case its callback may yet run.
+        bool IsLoading() const;
+
     private:
+        /// Tiles parsed by loader threads, waiting for {@link Update}.
+        struct loaded_tiles
+        {
+            ~loaded_tiles();
+
+            std::mutex lock;
+            std::vector<MapChunk*> chunks;
+        };
+
         std::vector<MapChunk*> _chunks;
+
+        std::shared_ptr<loaded_tiles> _loadedTiles;
+        std::vector<mpq_load_request> _requests;
     };
 }
@@ -5,24 +5,35 @@
 #include "DBStorage.hpp"
 #include "DBC.hpp"
 #include "DBCStructures.hpp"
-#include "ObjectMgr.hpp"
+#include "WorldSnapshot.hpp"
 #include "VolumeIntersections.hpp"
-#include "CGPlayer.hpp"
 #include "CAaBox.hpp"
+#include "MovementEngine.hpp"
+
+#include <shared/filesystem/mpq_file_loader.hpp>
+
+#include <algorithm>
+#include <iterator>
 
 namespace wowgm::game::geometry
 {
     using namespace wowgm::game::entities;
     using namespace wowgm::game::datastores;
+    using namespace wowgm::game::movement;
     using namespace wowgm::game::structures;
     using namespace wowgm::utilities;
 
     WorldRenderer* WorldRenderer::Instance()
     {
+        // Maps cancel their loads when destroyed, so the loader must be destroyed after them.
+        shared::filesystem::mpq_file_loader::Instance();
+
         static WorldRenderer instance;
         return &instance;
     }
 
+    WorldRenderer::~WorldRenderer() = default;
+
     void WorldRenderer::SetCoordinates(C3Vector const& position)
     {
         Instance()->_worldPosition = position;
@@ -46,10 +57,44 @@ namespace wowgm::game::geometry
 
         if (flags & GeometryLoadFlags::Terrain)
         {
-            _adt = new ADT(mapEntry->Directory);
+            auto adt = std::make_unique<ADT>(mapEntry->Directory, _worldPosition);
+
+            std::lock_guard<std::mutex> lock(_mapLock);
+            if (_nextAdt != nullptr)
+                _nextAdt->Cancel();
+
+            // A map replaced before it was ever drawn is retired along with the one being drawn.
+            std::swap(_nextAdt, adt);
+            if (adt != nullptr)
+                _retiredAdts.push_back(std::move(adt));
         }
     }
 
+    void WorldRenderer::SwapMaps()
+    {
+        // Freed once the lock is released, so that queuing a map never waits on tiles being freed.
+        std::vector<std::unique_ptr<ADT>> drainedAdts;
+
+        std::lock_guard<std::mutex> lock(_mapLock);
+        if (_nextAdt != nullptr)
+        {
+            if (_adt != nullptr)
+            {
+                _adt->Cancel();
+                _retiredAdts.push_back(std::move(_adt));
+            }
+
+            _adt = std::move(_nextAdt);
+        }
+
+        auto drained = std::partition(_retiredAdts.begin(), _retiredAdts.end(), [](std::unique_ptr<ADT> const& adt) {
+            return adt->IsLoading();
+        });
+
+        std::move(drained, _retiredAdts.end(), std::back_inserter(drainedAdts));
+        _retiredAdts.erase(drained, _retiredAdts.end());
+    }
+
     void WorldRenderer::Render()
     {
         Instance()->_Render();
@@ -57,17 +102,27 @@ namespace wowgm::game::geometry
 
     void WorldRenderer::_Render()
     {
-        CGPlayer* localPlayer = ObjectAccessor::GetLocalPlayer();
-        if (localPlayer == nullptr)
+        // Never touch live entities from here, they belong to the network thread.
+        WorldSnapshot const& snapshot = WorldSnapshots::Acquire();
+
+        SwapMaps();
+
+        if (!snapshot.HasLocalPlayer || _adt == nullptr)
             return;
 
+        _adt->Update();
+
+        // Snapshots only change with packets; movement extrapolated since then is published separately.
+        MovementPositions const& positions = sMovementEngine->AcquirePositions();
+        C3Vector const& playerPosition = positions.GetPosition(snapshot.LocalPlayer.GUID, snapshot.LocalPlayer.Position, snapshot.MovementTick);
+
         ADT::const_iterator end;
         for (ADT::iterator itr = _adt->begin(); itr != end; ++itr)
         {
             if (!(*itr)->HasGeometry())
                 continue;
 
-            if (!VolumeIntersections::boxIntersectsSphere((*itr)->GetBoundingBox(), localPlayer->GetPosition(), _farclip))
+            if (!VolumeIntersections::boxIntersectsSphere((*itr)->GetBoundingBox(), playerPosition, _farclip))
                 continue;
 
             (*itr)->Render();
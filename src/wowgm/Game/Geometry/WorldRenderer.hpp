@@ -3,6 +3,9 @@
 #include "C3Vector.hpp"
 
 #include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
 
 namespace wowgm::game::geometry
 {
@@ -20,6 +23,8 @@ namespace wowgm::game::geometry
     class WorldRenderer
     {
     public:
+        ~WorldRenderer();
+
         static void SetCoordinates(C3Vector const& position);
         static void SetMapID(uint32_t mapID);
 
@@ -33,11 +38,24 @@ namespace wowgm::game::geometry
 
         void _Render();
 
+        /// Switches to the map queued by {@link _LoadGeometry}, and frees previous maps once nothing loads into them.
+        void SwapMaps();
+
     private:
         C3Vector _worldPosition;
         uint32_t _mapID = -1;
 
-        ADT* _adt = nullptr;
+        /// Map being drawn. Only the render thread touches it.
+        std::unique_ptr<ADT> _adt;
+
+        /// Guards {@link _nextAdt} and {@link _retiredAdts}, which the network thread fills in.
+        std::mutex _mapLock;
+
+        /// Map loaded since the last frame, waiting for the render thread to switch to it.
+        std::unique_ptr<ADT> _nextAdt;
+
+        /// Previous maps, cancelled and kept until the callbacks of their loads have run.
+        std::vector<std::unique_ptr<ADT>> _retiredAdts;
 
         float _farclip = 1000.0f;
 
@@ -0,0 +1,451 @@
+#include "MovementEngine.hpp"
+#include "Updater.hpp"
+#include "CGObject.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <memory>
+#include <random>
+
+namespace wowgm::game::movement
+{
+    namespace
+    {
+        // Without terrain heights, there is nothing to land on; stop extrapolating falls after a while.
+        constexpr float MaxFallExtrapolation = 3.0f;
+    }
+
+    MovementEngine::MovementEngine() : _lastTick(std::chrono::steady_clock::now())
+    {
+
+    }
+
+    MovementEngine* MovementEngine::instance()
+    {
+        static std::shared_ptr<MovementEngine> instance = sUpdater->CreateUpdatable<MovementEngine>();
+        return instance.get();
+    }
+
+    void MovementEngine::Initialize()
+    {
+        instance();
+    }
+
+    void MovementEngine::Launch(CGObject* object, CMovementStatus const& movement)
+    {
+        std::lock_guard<std::mutex> lock(_lock);
+
+        ObjectGuid guid = object->GUID;
+
+        if (_restingPositions.erase(guid) != 0)
+            _positionsChanged = true;
+
+        auto splineItr = _splineIndices.find(guid);
+        if (splineItr != _splineIndices.end())
+            RemoveSpline(splineItr->second);
+
+        auto fallItr = _fallIndices.find(guid);
+        if (fallItr != _fallIndices.end())
+            RemoveFall(fallItr->second);
+
+        if (movement.Spline.Duration != 0)
+            LaunchSpline(guid, object, movement);
+        else if (movement.Flags & MOVEMENTFLAG_FALLING)
+            LaunchFall(guid, object, movement);
+    }
+
+    void MovementEngine::Stop(ObjectGuid const& guid)
+    {
+        std::lock_guard<std::mutex> lock(_lock);
+
+        _positionsChanged = true;
+        _restingPositions.erase(guid);
+
+        auto splineItr = _splineIndices.find(guid);
+        if (splineItr != _splineIndices.end())
+            RemoveSpline(splineItr->second);
+
+        auto fallItr = _fallIndices.find(guid);
+        if (fallItr != _fallIndices.end())
+            RemoveFall(fallItr->second);
+    }
+
+    void MovementEngine::Clear()
+    {
+        std::lock_guard<std::mutex> lock(_lock);
+
+        _splineLanes.Clear();
+        _splines.clear();
+        _splineIndices.clear();
+
+        _fallLanes.Clear();
+        _falls.clear();
+        _fallIndices.clear();
+
+        _restingPositions.clear();
+        _positionsChanged = true;
+    }
+
+    std::unique_lock<std::mutex> MovementEngine::LockPositions()
+    {
+        return std::unique_lock<std::mutex>(_lock);
+    }
+
+    uint64_t MovementEngine::CapturePositions()
+    {
+        _capturedTick = _tick;
+        return _tick;
+    }
+
+    MovementPositions const& MovementEngine::AcquirePositions()
+    {
+        _positions.acquire();
+        return _positions.read_buffer();
+    }
+
+    MovementEngineStatistics MovementEngine::GetStatistics()
+    {
+        std::lock_guard<std::mutex> lock(_lock);
+
+        MovementEngineStatistics statistics;
+        statistics.SplineCount = _splines.size();
+        statistics.FallCount = _falls.size();
+        statistics.LastTick = _lastTickDuration;
+        return statistics;
+    }
+
+    void MovementEngine::Update(uint32_t /* timeInterval */)
+    {
+        // The updater truncates intervals to whole milliseconds, which drifts by up to a millisecond per tick.
+        auto now = std::chrono::steady_clock::now();
+        float diff = std::chrono::duration<float, std::milli>(now - _lastTick).count();
+        _lastTick = now;
+
+        std::lock_guard<std::mutex> lock(_lock);
+
+        ++_tick;
+        Advance(diff);
+        PublishPositions();
+
+        _lastTickDuration = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - now);
+    }
+
+    void MovementEngine::Destroy()
+    {
+        Clear();
+    }
+
+    void MovementEngine::LaunchSpline(ObjectGuid const& guid, CGObject* object, CMovementStatus const& movement)
+    {
+        SplineMover mover;
+        mover.GUID = guid;
+        mover.Object = object;
+        mover.Cyclic = (movement.Spline.Flags & SPLINEFLAG_CYCLIC) != 0;
+        mover.Segment = 0;
+
+        mover.Points = movement.Spline.Points;
+        if (mover.Points.size() < 2)
+        {
+            mover.Points.clear();
+            mover.Points.push_back(movement.Position);
+            mover.Points.push_back(movement.Spline.Endpoint);
+        }
+
+        // Nodes are reached at constant speed: spread the duration proportionally to segment lengths.
+        float duration = float(movement.Spline.Duration);
+        float totalLength = 0.0f;
+
+        mover.NodeTimes.resize(mover.Points.size(), 0.0f);
+        for (size_t i = 1; i < mover.Points.size(); ++i)
+        {
+            totalLength += std::sqrt(mover.Points[i].distanceSquared(mover.Points[i - 1]));
+            mover.NodeTimes[i] = totalLength;
+        }
+
+        for (size_t i = 1; i < mover.NodeTimes.size(); ++i)
+        {
+            if (totalLength > 0.0f)
+                mover.NodeTimes[i] *= duration / totalLength;
+            else
+                mover.NodeTimes[i] = duration * float(i) / float(mover.NodeTimes.size() - 1);
+        }
+
+        size_t index = _splineLanes.Add();
+        _splineLanes.Elapsed[index] = std::min(float(movement.Spline.Time), duration);
+        _splineLanes.CatmullRom[index] = movement.Spline.Mode == SPLINEMODE_CATMULLROM ? 1.0f : 0.0f;
+
+        if ((movement.Spline.Flags & SPLINEFLAG_PARABOLIC) && movement.Spline.StartTime < movement.Spline.Duration)
+        {
+            _splineLanes.ParabolicStart[index] = float(movement.Spline.StartTime);
+            _splineLanes.ParabolicDuration[index] = (duration - float(movement.Spline.StartTime)) * 0.001f;
+            _splineLanes.VerticalAcceleration[index] = movement.Spline.VerticalAcceleration;
+        }
+
+        _splines.push_back(std::move(mover));
+        _splineIndices[guid] = index;
+
+        LoadSegment(index);
+    }
+
+    void MovementEngine::LaunchFall(ObjectGuid const& guid, CGObject* object, CMovementStatus const& movement)
+    {
+        size_t index = _fallLanes.Add();
+        _fallLanes.OriginX[index] = movement.Position.X;
+        _fallLanes.OriginY[index] = movement.Position.Y;
+        _fallLanes.OriginZ[index] = movement.Position.Z;
+        _fallLanes.VelocityX[index] = movement.FallInfo.Jump.HorizontalSpeed * movement.FallInfo.Jump.Cosinus;
+        _fallLanes.VelocityY[index] = movement.FallInfo.Jump.HorizontalSpeed * movement.FallInfo.Jump.Sinus;
+        _fallLanes.VerticalSpeed[index] = movement.FallInfo.VerticalSpeed;
+        _fallLanes.StartTime[index] = float(movement.FallInfo.Time) * 0.001f;
+
+        _falls.push_back({ guid, object });
+        _fallIndices[guid] = index;
+    }
+
+    void MovementEngine::RemoveSpline(size_t index)
+    {
+        _splineIndices.erase(_splines[index].GUID);
+
+        _splineLanes.SwapRemove(index);
+        if (index + 1 != _splines.size())
+        {
+            _splines[index] = std::move(_splines.back());
+            _splineIndices[_splines[index].GUID] = index;
+        }
+
+        _splines.pop_back();
+    }
+
+    void MovementEngine::RemoveFall(size_t index)
+    {
+        _fallIndices.erase(_falls[index].GUID);
+
+        _fallLanes.SwapRemove(index);
+        if (index + 1 != _falls.size())
+        {
+            _falls[index] = _falls.back();
+            _fallIndices[_falls[index].GUID] = index;
+        }
+
+        _falls.pop_back();
+    }
+
+    void MovementEngine::LoadSegment(size_t index)
+    {
+        SplineMover& mover = _splines[index];
+
+        float elapsed = _splineLanes.Elapsed[index];
+        size_t lastSegment = mover.Points.size() - 2;
+
+        mover.Segment = 0;
+        while (mover.Segment < lastSegment && elapsed >= mover.NodeTimes[mover.Segment + 1])
+            ++mover.Segment;
+
+        size_t pointCount = mover.Points.size();
+        size_t p1 = mover.Segment;
+        size_t p2 = p1 + 1;
+        size_t p0 = p1 > 0 ? p1 - 1 : (mover.Cyclic ? pointCount - 1 : p1);
+        size_t p3 = p2 + 1 < pointCount ? p2 + 1 : (mover.Cyclic ? 0 : p2);
+
+        size_t controls[] = { p0, p1, p2, p3 };
+        for (size_t i = 0; i < 4; ++i)
+        {
+            C3Vector const& point = mover.Points[controls[i]];
+            _splineLanes.Control[i * 3 + 0][index] = point.X;
+            _splineLanes.Control[i * 3 + 1][index] = point.Y;
+            _splineLanes.Control[i * 3 + 2][index] = point.Z;
+        }
+
+        float segmentStart = mover.NodeTimes[p1];
+        float segmentDuration = mover.NodeTimes[p2] - segmentStart;
+        _splineLanes.SegmentStart[index] = segmentStart;
+        _splineLanes.SegmentInvDuration[index] = segmentDuration > 0.0f ? 1.0f / segmentDuration : 0.0f;
+    }
+
+    void MovementEngine::Advance(float diff)
+    {
+        // Only segment changes and completions are handled per unit; evaluation is batched below.
+        for (size_t i = 0; i < _splines.size(); )
+        {
+            SplineMover& mover = _splines[i];
+            float duration = mover.NodeTimes.back();
+
+            float& elapsed = _splineLanes.Elapsed[i];
+            elapsed += diff;
+
+            if (elapsed >= duration)
+            {
+                if (!mover.Cyclic || duration <= 0.0f)
+                {
+                    // Snap to the final point and retire.
+                    if (mover.Object != nullptr)
+                        mover.Object->GetPosition() = mover.Points.back();
+
+                    Rest(mover.GUID, mover.Points.back());
+
+                    RemoveSpline(i);
+                    continue;
+                }
+
+                elapsed = std::fmod(elapsed, duration);
+                LoadSegment(i);
+            }
+            else if (mover.Segment + 2 < mover.Points.size() && elapsed >= mover.NodeTimes[mover.Segment + 1])
+                LoadSegment(i);
+
+            ++i;
+        }
+
+        float seconds = diff * 0.001f;
+        for (size_t i = 0; i < _falls.size(); )
+        {
+            _fallLanes.Elapsed[i] += seconds;
+            if (_fallLanes.Elapsed[i] >= MaxFallExtrapolation)
+            {
+                C3Vector position;
+                position.X = _fallLanes.X[i];
+                position.Y = _fallLanes.Y[i];
+                position.Z = _fallLanes.Z[i];
+                Rest(_falls[i].GUID, position);
+
+                RemoveFall(i);
+                continue;
+            }
+
+            ++i;
+        }
+
+        kernels::EvaluateSplines(_splineLanes);
+        kernels::EvaluateFalls(_fallLanes);
+
+        for (size_t i = 0; i < _splines.size(); ++i)
+        {
+            if (CGObject* object = _splines[i].Object)
+            {
+                C3Vector& position = object->GetPosition();
+                position.X = _splineLanes.X[i];
+                position.Y = _splineLanes.Y[i];
+                position.Z = _splineLanes.Z[i];
+            }
+        }
+
+        for (size_t i = 0; i < _falls.size(); ++i)
+        {
+            if (CGObject* object = _falls[i].Object)
+            {
+                C3Vector& position = object->GetPosition();
+                position.X = _fallLanes.X[i];
+                position.Y = _fallLanes.Y[i];
+                position.Z = _fallLanes.Z[i];
+            }
+        }
+    }
+
+    void MovementEngine::Rest(ObjectGuid const& guid, C3Vector const& position)
+    {
+        MovementPosition& resting = _restingPositions[guid];
+        resting.Position = position;
+        resting.Tick = _tick;
+
+        _positionsChanged = true;
+    }
+
+    void MovementEngine::PublishPositions()
+    {
+        // Snapshots captured since these units came to rest hold their final position already.
+        for (auto itr = _restingPositions.begin(); itr != _restingPositions.end(); )
+        {
+            if (itr->second.Tick <= _capturedTick)
+            {
+                itr = _restingPositions.erase(itr);
+                _positionsChanged = true;
+            }
+            else
+                ++itr;
+        }
+
+        if (_splines.empty() && _falls.empty() && !_positionsChanged)
+            return;
+
+        // The buffer holds stale positions; reuse its storage.
+        MovementPositions& positions = _positions.write_buffer();
+        positions.Units.clear();
+        positions.Units.reserve(_splines.size() + _falls.size() + _restingPositions.size());
+
+        for (auto&& itr : _restingPositions)
+            positions.Units.emplace(itr.first, itr.second);
+
+        auto publish = [&positions, this](ObjectGuid const& guid, float x, float y, float z) {
+            MovementPosition& position = positions.Units[guid];
+            position.Position.X = x;
+            position.Position.Y = y;
+            position.Position.Z = z;
+            position.Tick = _tick;
+        };
+
+        for (size_t i = 0; i < _splines.size(); ++i)
+            publish(_splines[i].GUID, _splineLanes.X[i], _splineLanes.Y[i], _splineLanes.Z[i]);
+
+        for (size_t i = 0; i < _falls.size(); ++i)
+            publish(_falls[i].GUID, _fallLanes.X[i], _fallLanes.Y[i], _fallLanes.Z[i]);
+
+        _positions.publish();
+        _positionsChanged = false;
+    }
+
+    std::vector<std::chrono::microseconds> MovementEngine::RunBenchmark(size_t unitCount, size_t tickCount)
+    {
+        MovementEngine engine;
+
+        std::mt19937 generator(0x5EED);
+        std::uniform_real_distribution<float> coordinate(-1000.0f, 1000.0f);
+        std::uniform_int_distribution<uint32_t> pointCount(2, 12);
+        std::uniform_int_distribution<uint32_t> duration(2000, 60000);
+
+        for (size_t i = 0; i < unitCount; ++i)
+        {
+            CMovementStatus movement;
+            movement.Position.X = coordinate(generator);
+            movement.Position.Y = coordinate(generator);
+            movement.Position.Z = coordinate(generator);
+
+            ObjectGuid guid(HighGuid::Unit, 0, uint32_t(i + 1));
+
+            // One in eight units falls, the others follow splines of every kind.
+            if (i % 8 == 7)
+            {
+                movement.Flags = MOVEMENTFLAG_FALLING;
+                movement.FallInfo.VerticalSpeed = -7.9f;
+                movement.FallInfo.Jump.HorizontalSpeed = 7.0f;
+                movement.FallInfo.Jump.Cosinus = 1.0f;
+                engine.LaunchFall(guid, nullptr, movement);
+                continue;
+            }
+
+            movement.Spline.Duration = duration(generator);
+            movement.Spline.Mode = (i % 2) ? SPLINEMODE_CATMULLROM : SPLINEMODE_LINEAR;
+            movement.Spline.Flags = (i % 3 == 0) ? SPLINEFLAG_CYCLIC : ((i % 5 == 0) ? SPLINEFLAG_PARABOLIC : MoveSplineFlags(0));
+            movement.Spline.VerticalAcceleration = 19.29f;
+            movement.Spline.Points.resize(pointCount(generator));
+            for (C3Vector& point : movement.Spline.Points)
+            {
+                point.X = coordinate(generator);
+                point.Y = coordinate(generator);
+                point.Z = coordinate(generator);
+            }
+
+            engine.LaunchSpline(guid, nullptr, movement);
+        }
+
+        std::vector<std::chrono::microseconds> tickDurations;
+        tickDurations.reserve(tickCount);
+        for (size_t i = 0; i < tickCount; ++i)
+        {
+            auto start = std::chrono::steady_clock::now();
+            engine.Advance(16.0f);
+            tickDurations.push_back(std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start));
+        }
+
+        return tickDurations;
+    }
+}
@@ -0,0 +1,183 @@
+#pragma once
+
+#include "Updatable.hpp"
+#include "MovementKernels.hpp"
+
+#include "ObjectGuid.hpp"
+#include "C3Vector.hpp"
+#include "CMovementStatus.hpp"
+
+#include <extstd/containers/flat_hash_map.hpp>
+#include <extstd/threading/triple_buffer.hpp>
+
+#include <chrono>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+namespace wowgm::game::entities
+{
+    class CGObject;
+}
+
+namespace wowgm::game::movement
+{
+    using namespace wowgm::game::structures;
+    using namespace wowgm::game::entities;
+
+    enum MovementFlags : uint32_t
+    {
+        MOVEMENTFLAG_FALLING      = 0x00000800,
+    };
+
+    enum MoveSplineFlags : uint32_t
+    {
+        SPLINEFLAG_PARABOLIC      = 0x00000800,
+        SPLINEFLAG_CYCLIC         = 0x00080000,
+    };
+
+    enum MoveSplineMode : uint8_t
+    {
+        SPLINEMODE_LINEAR         = 0,
+        SPLINEMODE_CATMULLROM     = 1,
+    };
+
+    /// Position of a unit as of a tick of the {@link MovementEngine}.
+    struct MovementPosition
+    {
+        C3Vector Position;
+        uint64_t Tick = 0;
+    };
+
+    /// Positions published by a tick of the {@link MovementEngine}.
+    struct MovementPositions
+    {
+        extstd::containers::flat_hash_map<ObjectGuid, MovementPosition> Units;
+
+        /// Position of {@param guid} if the engine moved it after tick {@param sinceTick}, {@param fallback} otherwise.
+        C3Vector const& GetPosition(ObjectGuid const& guid, C3Vector const& fallback, uint64_t sinceTick) const
+        {
+            auto itr = Units.find(guid);
+            return itr != Units.end() && itr->second.Tick > sinceTick ? itr->second.Position : fallback;
+        }
+    };
+
+    struct MovementEngineStatistics
+    {
+        size_t SplineCount = 0;
+        size_t FallCount = 0;
+        std::chrono::microseconds LastTick{ 0 };
+    };
+
+    /**
+     * Extrapolates the position of moving units between server updates.
+     *
+     * Splines and falls received from the server are kept in structure-of-arrays lanes; every tick
+     * advances all of them in a single pass through the SIMD kernels, and writes the results back
+     * to the entities.
+     *
+     * The network thread launches and stops movements; the updater thread advances them. Positions
+     * of registered entities are written under the engine's lock, and must be read under
+     * {@link LockPositions} from any other thread.
+     *
+     * World snapshots only capture positions when a packet is handled, so every tick also publishes
+     * the positions it computed, which the render thread overlays on the snapshot it draws.
+     */
+    class MovementEngine final : public wowgm::threading::Updatable
+    {
+        struct SplineMover
+        {
+            ObjectGuid GUID;
+            CGObject* Object;
+
+            std::vector<C3Vector> Points;
+            std::vector<float> NodeTimes; // Milliseconds at which each point is reached
+            bool Cyclic;
+            size_t Segment;
+        };
+
+        struct FallMover
+        {
+            ObjectGuid GUID;
+            CGObject* Object;
+        };
+
+    public:
+        MovementEngine();
+
+        static MovementEngine* instance();
+
+        /// Registers the engine with the updater. Call it before the updater starts so that no tick is missed.
+        static void Initialize();
+
+        /// Starts extrapolating the movement described by {@param movement}, replacing any movement {@param object} had.
+        void Launch(CGObject* object, CMovementStatus const& movement);
+
+        /// Stops extrapolating the movement of the given object. Must be called before the object is destroyed.
+        void Stop(ObjectGuid const& guid);
+
+        /// Drops every movement. Must be called before the entities are released.
+        void Clear();
+
+        std::unique_lock<std::mutex> LockPositions();
+
+        /**
+         * Returns the tick entity positions are current as of. Must be called under {@link LockPositions} by whoever
+         * copies them, which lets the engine stop publishing units that came to rest before then.
+         */
+        uint64_t CapturePositions();
+
+        /// Returns the positions published by the most recent tick. Render thread only; stays valid until the next call.
+        MovementPositions const& AcquirePositions();
+
+        MovementEngineStatistics GetStatistics();
+
+        void Update(uint32_t timeInterval) override;
+        void Destroy() override;
+
+        /**
+         * Moves {@param unitCount} synthetic units along random splines and falls, without entities, and measures
+         * how long every tick takes.
+         */
+        static std::vector<std::chrono::microseconds> RunBenchmark(size_t unitCount, size_t tickCount);
+
+    private:
+        void LaunchSpline(ObjectGuid const& guid, CGObject* object, CMovementStatus const& movement);
+        void LaunchFall(ObjectGuid const& guid, CGObject* object, CMovementStatus const& movement);
+
+        void RemoveSpline(size_t index);
+        void RemoveFall(size_t index);
+
+        void LoadSegment(size_t index);
+
+        /// Keeps publishing the position {@param guid} came to rest at until positions are captured.
+        void Rest(ObjectGuid const& guid, C3Vector const& position);
+
+        /// Publishes the position of every moving unit, and of those that came to rest since positions were captured. The lock must be held.
+        void PublishPositions();
+
+        /// Advances every movement by {@param diff} milliseconds. The lock must be held.
+        void Advance(float diff);
+
+        std::mutex _lock;
+
+        SplineLanes _splineLanes;
+        std::vector<SplineMover> _splines;
+        extstd::containers::flat_hash_map<ObjectGuid, size_t> _splineIndices;
+
+        FallLanes _fallLanes;
+        std::vector<FallMover> _falls;
+        extstd::containers::flat_hash_map<ObjectGuid, size_t> _fallIndices;
+
+        uint64_t _tick = 0;
+        uint64_t _capturedTick = 0;
+        extstd::containers::flat_hash_map<ObjectGuid, MovementPosition> _restingPositions;
+        bool _positionsChanged = false;
+        extstd::threading::triple_buffer<MovementPositions> _positions; // Produced by the updater thread, consumed by the render thread.
+
+        std::chrono::steady_clock::time_point _lastTick;
+        std::chrono::microseconds _lastTickDuration{ 0 };
+    };
+}
+
+#define sMovementEngine wowgm::game::movement::MovementEngine::instance()
@@ -0,0 +1,217 @@
+#include "MovementKernels.hpp"
+
+#include <algorithm>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+# define MOVEMENT_KERNELS_SSE2
+# include <emmintrin.h>
+#endif
+
+namespace wowgm::game::movement
+{
+    namespace
+    {
+        constexpr float Gravity = 19.29110527038574f;
+        constexpr float TerminalVelocity = 60.148003f;
+
+        template <typename F>
+        void ForEachColumn(SplineLanes& lanes, F&& f)
+        {
+            f(lanes.Elapsed); f(lanes.SegmentStart); f(lanes.SegmentInvDuration); f(lanes.CatmullRom);
+            for (std::vector<float>& column : lanes.Control)
+                f(column);
+            f(lanes.ParabolicStart); f(lanes.ParabolicDuration); f(lanes.VerticalAcceleration);
+            f(lanes.X); f(lanes.Y); f(lanes.Z);
+        }
+
+        template <typename F>
+        void ForEachColumn(FallLanes& lanes, F&& f)
+        {
+            f(lanes.OriginX); f(lanes.OriginY); f(lanes.OriginZ);
+            f(lanes.VelocityX); f(lanes.VelocityY); f(lanes.VerticalSpeed);
+            f(lanes.StartTime); f(lanes.Elapsed);
+            f(lanes.X); f(lanes.Y); f(lanes.Z);
+        }
+
+        template <typename Lanes>
+        size_t AddLane(Lanes& lanes)
+        {
+            size_t index = lanes.size();
+            ForEachColumn(lanes, [](std::vector<float>& column) { column.push_back(0.0f); });
+            return index;
+        }
+
+        template <typename Lanes>
+        void SwapRemoveLane(Lanes& lanes, size_t index)
+        {
+            ForEachColumn(lanes, [index](std::vector<float>& column) {
+                column[index] = column.back();
+                column.pop_back();
+            });
+        }
+
+        /// Distance fallen after {@param t} seconds, starting at {@param v0} yd/s and capped at terminal velocity.
+        inline float FallDistance(float v0, float t)
+        {
+            float terminalTime = std::max((TerminalVelocity - v0) / Gravity, 0.0f);
+            if (t < terminalTime)
+                return v0 * t + 0.5f * Gravity * t * t;
+
+            return v0 * terminalTime + 0.5f * Gravity * terminalTime * terminalTime + TerminalVelocity * (t - terminalTime);
+        }
+
+        inline void EvaluateSpline(SplineLanes& lanes, size_t i)
+        {
+            float u = std::clamp((lanes.Elapsed[i] - lanes.SegmentStart[i]) * lanes.SegmentInvDuration[i], 0.0f, 1.0f);
+            float u2 = u * u;
+            float u3 = u2 * u;
+            float c = lanes.CatmullRom[i];
+
+            float w0 = c * 0.5f * (-u3 + 2.0f * u2 - u);
+            float w1 = (1.0f - u) + c * (0.5f * (3.0f * u3 - 5.0f * u2 + 2.0f) - (1.0f - u));
+            float w2 = u + c * (0.5f * (-3.0f * u3 + 4.0f * u2 + u) - u);
+            float w3 = c * 0.5f * (u3 - u2);
+
+            auto& p = lanes.Control;
+            lanes.X[i] = w0 * p[0][i] + w1 * p[3][i] + w2 * p[6][i] + w3 * p[9][i];
+            lanes.Y[i] = w0 * p[1][i] + w1 * p[4][i] + w2 * p[7][i] + w3 * p[10][i];
+            lanes.Z[i] = w0 * p[2][i] + w1 * p[5][i] + w2 * p[8][i] + w3 * p[11][i];
+
+            float passed = std::max((lanes.Elapsed[i] - lanes.ParabolicStart[i]) * 0.001f, 0.0f);
+            lanes.Z[i] += (lanes.ParabolicDuration[i] - passed) * 0.5f * lanes.VerticalAcceleration[i] * passed;
+        }
+
+        inline void EvaluateFall(FallLanes& lanes, size_t i)
+        {
+            float startTime = lanes.StartTime[i];
+            float elapsed = lanes.Elapsed[i];
+
+            lanes.X[i] = lanes.OriginX[i] + lanes.VelocityX[i] * elapsed;
+            lanes.Y[i] = lanes.OriginY[i] + lanes.VelocityY[i] * elapsed;
+            lanes.Z[i] = lanes.OriginZ[i] - (FallDistance(lanes.VerticalSpeed[i], startTime + elapsed) - FallDistance(lanes.VerticalSpeed[i], startTime));
+        }
+
+#ifdef MOVEMENT_KERNELS_SSE2
+        inline __m128 Select(__m128 mask, __m128 a, __m128 b)
+        {
+            return _mm_or_ps(_mm_and_ps(mask, a), _mm_andnot_ps(mask, b));
+        }
+
+        inline __m128 FallDistance(__m128 v0, __m128 t)
+        {
+            __m128 gravity = _mm_set1_ps(Gravity);
+            __m128 halfGravity = _mm_set1_ps(0.5f * Gravity);
+            __m128 terminalVelocity = _mm_set1_ps(TerminalVelocity);
+
+            __m128 terminalTime = _mm_max_ps(_mm_div_ps(_mm_sub_ps(terminalVelocity, v0), gravity), _mm_setzero_ps());
+
+            __m128 accelerating = _mm_add_ps(_mm_mul_ps(v0, t), _mm_mul_ps(halfGravity, _mm_mul_ps(t, t)));
+            __m128 terminal = _mm_add_ps(
+                _mm_add_ps(_mm_mul_ps(v0, terminalTime), _mm_mul_ps(halfGravity, _mm_mul_ps(terminalTime, terminalTime))),
+                _mm_mul_ps(terminalVelocity, _mm_sub_ps(t, terminalTime)));
+
+            return Select(_mm_cmplt_ps(t, terminalTime), accelerating, terminal);
+        }
+#endif
+    }
+
+    size_t SplineLanes::Add() { return AddLane(*this); }
+    void SplineLanes::SwapRemove(size_t index) { SwapRemoveLane(*this, index); }
+    void SplineLanes::Clear() { ForEachColumn(*this, [](std::vector<float>& column) { column.clear(); }); }
+
+    size_t FallLanes::Add() { return AddLane(*this); }
+    void FallLanes::SwapRemove(size_t index) { SwapRemoveLane(*this, index); }
+    void FallLanes::Clear() { ForEachColumn(*this, [](std::vector<float>& column) { column.clear(); }); }
+
+    namespace kernels
+    {
+        void EvaluateSplines(SplineLanes& lanes)
+        {
+            size_t i = 0;
+
+#ifdef MOVEMENT_KERNELS_SSE2
+            __m128 zero = _mm_setzero_ps();
+            __m128 one = _mm_set1_ps(1.0f);
+            __m128 half = _mm_set1_ps(0.5f);
+            __m128 two = _mm_set1_ps(2.0f);
+            __m128 three = _mm_set1_ps(3.0f);
+            __m128 four = _mm_set1_ps(4.0f);
+            __m128 five = _mm_set1_ps(5.0f);
+            __m128 milliseconds = _mm_set1_ps(0.001f);
+
+            auto& p = lanes.Control;
+
+            for (; i + 4 <= lanes.size(); i += 4)
+            {
+                __m128 elapsed = _mm_loadu_ps(&lanes.Elapsed[i]);
+
+                __m128 u = _mm_mul_ps(_mm_sub_ps(elapsed, _mm_loadu_ps(&lanes.SegmentStart[i])), _mm_loadu_ps(&lanes.SegmentInvDuration[i]));
+                u = _mm_min_ps(_mm_max_ps(u, zero), one);
+                __m128 u2 = _mm_mul_ps(u, u);
+                __m128 u3 = _mm_mul_ps(u2, u);
+                __m128 c = _mm_loadu_ps(&lanes.CatmullRom[i]);
+
+                // Catmull-Rom basis
+                __m128 cr0 = _mm_mul_ps(half, _mm_sub_ps(_mm_sub_ps(_mm_mul_ps(two, u2), u3), u));
+                __m128 cr1 = _mm_mul_ps(half, _mm_add_ps(_mm_sub_ps(_mm_mul_ps(three, u3), _mm_mul_ps(five, u2)), two));
+                __m128 cr2 = _mm_mul_ps(half, _mm_add_ps(_mm_sub_ps(_mm_mul_ps(four, u2), _mm_mul_ps(three, u3)), u));
+                __m128 cr3 = _mm_mul_ps(half, _mm_sub_ps(u3, u2));
+
+                // Blend towards the linear basis (0, 1 - u, u, 0)
+                __m128 l1 = _mm_sub_ps(one, u);
+                __m128 w0 = _mm_mul_ps(c, cr0);
+                __m128 w1 = _mm_add_ps(l1, _mm_mul_ps(c, _mm_sub_ps(cr1, l1)));
+                __m128 w2 = _mm_add_ps(u, _mm_mul_ps(c, _mm_sub_ps(cr2, u)));
+                __m128 w3 = _mm_mul_ps(c, cr3);
+
+                __m128 x = _mm_add_ps(
+                    _mm_add_ps(_mm_mul_ps(w0, _mm_loadu_ps(&p[0][i])), _mm_mul_ps(w1, _mm_loadu_ps(&p[3][i]))),
+                    _mm_add_ps(_mm_mul_ps(w2, _mm_loadu_ps(&p[6][i])), _mm_mul_ps(w3, _mm_loadu_ps(&p[9][i]))));
+                __m128 y = _mm_add_ps(
+                    _mm_add_ps(_mm_mul_ps(w0, _mm_loadu_ps(&p[1][i])), _mm_mul_ps(w1, _mm_loadu_ps(&p[4][i]))),
+                    _mm_add_ps(_mm_mul_ps(w2, _mm_loadu_ps(&p[7][i])), _mm_mul_ps(w3, _mm_loadu_ps(&p[10][i]))));
+                __m128 z = _mm_add_ps(
+                    _mm_add_ps(_mm_mul_ps(w0, _mm_loadu_ps(&p[2][i])), _mm_mul_ps(w1, _mm_loadu_ps(&p[5][i]))),
+                    _mm_add_ps(_mm_mul_ps(w2, _mm_loadu_ps(&p[8][i])), _mm_mul_ps(w3, _mm_loadu_ps(&p[11][i]))));
+
+                // Parabolic elevation: (duration - passed) * acceleration / 2 * passed
+                __m128 passed = _mm_max_ps(_mm_mul_ps(_mm_sub_ps(elapsed, _mm_loadu_ps(&lanes.ParabolicStart[i])), milliseconds), zero);
+                __m128 elevation = _mm_mul_ps(_mm_mul_ps(_mm_sub_ps(_mm_loadu_ps(&lanes.ParabolicDuration[i]), passed), half),
+                    _mm_mul_ps(_mm_loadu_ps(&lanes.VerticalAcceleration[i]), passed));
+
+                _mm_storeu_ps(&lanes.X[i], x);
+                _mm_storeu_ps(&lanes.Y[i], y);
+                _mm_storeu_ps(&lanes.Z[i], _mm_add_ps(z, elevation));
+            }
+#endif
+
+            for (; i < lanes.size(); ++i)
+                EvaluateSpline(lanes, i);
+        }
+
+        void EvaluateFalls(FallLanes& lanes)
+        {
+            size_t i = 0;
+
+#ifdef MOVEMENT_KERNELS_SSE2
+            for (; i + 4 <= lanes.size(); i += 4)
+            {
+                __m128 startTime = _mm_loadu_ps(&lanes.StartTime[i]);
+                __m128 elapsed = _mm_loadu_ps(&lanes.Elapsed[i]);
+                __m128 verticalSpeed = _mm_loadu_ps(&lanes.VerticalSpeed[i]);
+
+                __m128 x = _mm_add_ps(_mm_loadu_ps(&lanes.OriginX[i]), _mm_mul_ps(_mm_loadu_ps(&lanes.VelocityX[i]), elapsed));
+                __m128 y = _mm_add_ps(_mm_loadu_ps(&lanes.OriginY[i]), _mm_mul_ps(_mm_loadu_ps(&lanes.VelocityY[i]), elapsed));
+                __m128 fallen = _mm_sub_ps(FallDistance(verticalSpeed, _mm_add_ps(startTime, elapsed)), FallDistance(verticalSpeed, startTime));
+
+                _mm_storeu_ps(&lanes.X[i], x);
+                _mm_storeu_ps(&lanes.Y[i], y);
+                _mm_storeu_ps(&lanes.Z[i], _mm_sub_ps(_mm_loadu_ps(&lanes.OriginZ[i]), fallen));
+            }
+#endif
+
+            for (; i < lanes.size(); ++i)
+                EvaluateFall(lanes, i);
+        }
+    }
+}
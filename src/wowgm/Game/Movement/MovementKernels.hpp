@@ -0,0 +1,75 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <vector>
+
+namespace wowgm::game::movement
+{
+    /**
+     * Structure-of-arrays state of every unit currently following a spline.
+     *
+     * Each lane holds the four control points of the segment the unit is on. Linear segments are
+     * expressed as Catmull-Rom segments with their weights blended back to a lerp, so that both
+     * modes go through the same SIMD kernel.
+     */
+    struct SplineLanes final
+    {
+        std::vector<float> Elapsed;             // Milliseconds since the start of the spline
+        std::vector<float> SegmentStart;        // Milliseconds at which the current segment starts
+        std::vector<float> SegmentInvDuration;  // 1 / segment duration, in ms^-1
+        std::vector<float> CatmullRom;          // 1.0f for Catmull-Rom, 0.0f for linear
+
+        std::array<std::vector<float>, 12> Control; // P0.xyz, P1.xyz, P2.xyz, P3.xyz
+
+        std::vector<float> ParabolicStart;      // Milliseconds at which the parabolic arc starts
+        std::vector<float> ParabolicDuration;   // Duration of the parabolic arc, in seconds
+        std::vector<float> VerticalAcceleration;// 0.0f if the spline is not parabolic
+
+        std::vector<float> X;
+        std::vector<float> Y;
+        std::vector<float> Z;
+
+        size_t size() const { return Elapsed.size(); }
+
+        /// Appends a zeroed lane and returns its index.
+        size_t Add();
+
+        /// Moves the last lane to {@param index} and drops it.
+        void SwapRemove(size_t index);
+
+        void Clear();
+    };
+
+    /// Structure-of-arrays state of every unit currently falling or jumping.
+    struct FallLanes final
+    {
+        std::vector<float> OriginX;       // Position when the movement was received
+        std::vector<float> OriginY;
+        std::vector<float> OriginZ;
+        std::vector<float> VelocityX;     // Horizontal velocity, in yd/s
+        std::vector<float> VelocityY;
+        std::vector<float> VerticalSpeed; // Initial vertical speed, in yd/s, positive when moving down
+        std::vector<float> StartTime;     // Seconds into the fall when the movement was received
+        std::vector<float> Elapsed;       // Seconds since the movement was received
+
+        std::vector<float> X;
+        std::vector<float> Y;
+        std::vector<float> Z;
+
+        size_t size() const { return Elapsed.size(); }
+
+        size_t Add();
+        void SwapRemove(size_t index);
+        void Clear();
+    };
+
+    namespace kernels
+    {
+        /// Evaluates every lane at its current elapsed time, writing X, Y and Z.
+        void EvaluateSplines(SplineLanes& lanes);
+
+        /// Evaluates every lane at its current elapsed time, writing X, Y and Z.
+        void EvaluateFalls(FallLanes& lanes);
+    }
+}
@@ -1,7 +1,7 @@
 #pragma once
 
 #include <cstdint>
-#include <unordered_map>
+#include <extstd/containers/flat_hash_map.hpp>
 
 namespace wowgm::game
 {
@@ -24,7 +24,7 @@ namespace wowgm::game
         uint32_t _areaID;
         uint32_t _zoneID;
 
-        std::unordered_map<uint32_t, uint32_t> _worldStates;
+        extstd::containers::flat_hash_map<uint32_t, uint32_t> _worldStates;
     };
 }
 
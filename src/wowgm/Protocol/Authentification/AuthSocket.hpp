@@ -8,7 +8,7 @@
 
 #include <boost/asio/io_context.hpp>
 
-#include <unordered_map>
+#include <extstd/containers/flat_hash_map.hpp>
 
 namespace boost {
     namespace system {
@@ -56,7 +56,7 @@ namespace wowgm::protocol::authentification
             bool (AuthSocket::*handler)();
         };
 
-        std::unordered_map<uint8_t, AuthHandler> _packetHandlers;
+        extstd::containers::flat_hash_map<uint8_t, AuthHandler> _packetHandlers;
 
         BigNumber M2;
     };
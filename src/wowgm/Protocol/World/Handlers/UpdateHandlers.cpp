@@ -4,6 +4,10 @@
 #include "UpdatePackets.hpp"
 #include "Packet.hpp"
 #include "ObjectMgr.hpp"
+#include "ObjectUpdateBatch.hpp"
+#include "ObjectChangeNotifier.hpp"
+#include "WorldSnapshot.hpp"
+#include "MovementEngine.hpp"
 
 #include "CGObject.hpp"
 #include "CGUnit.hpp"
@@ -23,75 +27,55 @@ namespace wowgm::protocol::world
 
     bool WorldSocket::HandleObjectUpdate(ClientUpdateObject& packet)
     {
+        if (ObjectAccessor::GetArena() == nullptr)
+            ObjectAccessor::ResetArena(packet.MapID);
+
+        // The out-of-range block always comes first; apply it before anything else.
         for (ObjectGuid const& itr : packet.DestroyObjects)
             ObjectAccessor::Destroy(itr);
 
-        for (CClientObjCreate& itr : packet.Updates)
+        ObjectAccessor::Publish();
+
+        ObjectUpdateBatch batch(packet.Updates);
+        batch.Apply();
+
+        for (CClientObjCreate const& itr : packet.Updates)
         {
-            if (itr.UpdateType == UpdateType::Values)
-            {
-                if (CGObject* currentUnit = ObjectAccessor::GetObject<CGObject>(itr.GUID))
-                    currentUnit->UpdateDescriptors(itr.Values);
-            }
-            else
-            {
-                switch (itr.GUID.GetTypeId())
-                {
-                    case TYPEID_UNIT:
-                    {
-                        CGUnit* unit = new CGUnit(itr);
-                        ObjectHolder<CGUnit>::Insert(unit);
-                        unit->UpdateDescriptors(itr.Values);
-                        break;
-                    }
-                    case TYPEID_ITEM:
-                    {
-                        CGItem* item = new CGItem(itr);
-                        ObjectHolder<CGItem>::Insert(item);
-                        item->UpdateDescriptors(itr.Values);
-                        break;
-                    }
-                    case TYPEID_CONTAINER:
-                    {
-                        CGContainer* container = new CGContainer(itr);
-                        ObjectHolder<CGContainer>::Insert(container);
-                        container->UpdateDescriptors(itr.Values);
-                        break;
-                    }
-                    case TYPEID_PLAYER:
-                    {
-                        CGPlayer* player = new CGPlayer(itr);
-                        ObjectHolder<CGPlayer>::Insert(player);
-                        player->UpdateDescriptors(itr.Values);
-
-                        if (itr.Movement.ThisIsYou)
-                        {
-                            WorldRenderer::SetCoordinates(itr.Movement.Position);
-                            WorldRenderer::SetMapID(packet.MapID);
-                            WorldRenderer::LoadGeometry((GeometryLoadFlags)(GeometryLoadFlags::Terrain | GeometryLoadFlags::Mmaps | GeometryLoadFlags::Vmaps));
-
-                            ObjectAccessor::s_localPlayer = itr.GUID;
-                        }
-                        break;
-                    }
-                }
-            }
+            if (itr.UpdateType != UpdateType::CreateObject1 && itr.UpdateType != UpdateType::CreateObject2)
+                continue;
+
+            if (CGObject* object = ObjectAccessor::GetObject<CGObject>(itr.GUID))
+                sMovementEngine->Launch(object, itr.Movement);
+
+            if (itr.GUID.GetTypeId() != TYPEID_PLAYER || !itr.Movement.ThisIsYou)
+                continue;
+
+            WorldRenderer::SetCoordinates(itr.Movement.Position);
+            WorldRenderer::SetMapID(packet.MapID);
+            WorldRenderer::LoadGeometry((GeometryLoadFlags)(GeometryLoadFlags::Terrain | GeometryLoadFlags::Mmaps | GeometryLoadFlags::Vmaps));
+
+            ObjectAccessor::SetLocalPlayer(itr.GUID);
         }
 
+        sObjectChangeNotifier->Flush(batch.GetChangedObjects());
+
+        WorldSnapshots::Publish();
         return true;
     }
 
     bool WorldSocket::HandleDestroyObject(ClientDestroyObject& packet)
     {
         CGObject* object = ObjectAccessor::GetObject<CGObject>(packet.GUID);
-        if (object != nullptr)
+        if (object == nullptr)
             return true;
 
         // if (packet.OnDeath)
         //     object->OnDeath();
 
         ObjectAccessor::Destroy(object);
+        ObjectAccessor::Publish();
 
+        WorldSnapshots::Publish();
         return true;
     }
 }
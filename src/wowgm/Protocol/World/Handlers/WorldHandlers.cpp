@@ -5,6 +5,8 @@
 #include "Packet.hpp"
 
 #include "WorldRenderer.hpp"
+#include "ObjectMgr.hpp"
+#include "WorldSnapshot.hpp"
 #include "Utils.hpp"
 
 namespace wowgm::protocol::world
@@ -12,10 +14,15 @@ namespace wowgm::protocol::world
     using namespace wowgm::utilities;
     using namespace wowgm::game::structures;
     using namespace wowgm::game::geometry;
+    using namespace wowgm::game::entities;
     using namespace packets;
 
     bool WorldSocket::HandleNewWorld(ClientNewWorld& packet)
     {
+        // Every entity we know of belongs to the map we are leaving.
+        ObjectAccessor::ResetArena(packet.MapID);
+        WorldSnapshots::Publish();
+
         // WorldRenderer::UnloadCurrentGeometry();
         WorldRenderer::SetCoordinates(packet.Position);
         WorldRenderer::SetMapID(packet.MapID);
@@ -12,6 +12,7 @@
 #include <typeinfo>
 #include <iomanip>
 #include <shared/log/log.hpp>
+#include <shared/threading/epoch_manager.hpp>
 
 namespace wowgm::protocol::world
 {
@@ -126,6 +127,8 @@ namespace wowgm::protocol::world
             if (!sOpcodeHandler->HasHandler(worldPacket.GetOpcode()))
                 return true;
 
+            // Handlers hold raw entity pointers; keep what they destroy alive until the next packet.
+            shared::threading::epoch_guard guard;
             return (*sOpcodeHandler)[worldPacket.GetOpcode()]->Call(this, worldPacket);
         }
         else
@@ -30,6 +30,7 @@ namespace wowgm::threading
         if (_worker.joinable())
             _worker.join(); // join
 
+        std::lock_guard<std::mutex> lock(_updatablesLock);
         for (auto&& upd : _updatables)
             upd->Destroy();
 
@@ -48,6 +49,8 @@ namespace wowgm::threading
         while (future.wait_for(std::chrono::milliseconds(1)) == std::future_status::timeout)
         {
             auto milliseconds = chrono::duration_cast<chrono::microseconds>(hrc::now() - lastUpdateTick);
+
+            std::lock_guard<std::mutex> lock(_updatablesLock);
             for (auto&& upd : _updatables)
                 upd->Update(static_cast<uint32_t>(milliseconds.count()) / 1000);
 
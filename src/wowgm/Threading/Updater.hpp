@@ -4,6 +4,8 @@
 #include <thread>
 #include <condition_variable>
 #include <future>
+#include <mutex>
+#include <vector>
 #include <cstdint>
 
 namespace wowgm::threading {
@@ -24,6 +26,7 @@ namespace wowgm::threading {
         std::shared_ptr<T> CreateUpdatable(Args&&... args)
         {
             std::shared_ptr<T> ptr = std::make_shared<T>(std::forward<Args>(args)...);
+            std::lock_guard<std::mutex> lock(_updatablesLock);
             _updatables.push_back(ptr);
             return ptr;
         }
@@ -32,6 +35,7 @@ namespace wowgm::threading {
         std::shared_ptr<T> CreateUpdatable()
         {
             std::shared_ptr<T> ptr = std::make_shared<T>();
+            std::lock_guard<std::mutex> lock(_updatablesLock);
             _updatables.push_back(ptr);
             return ptr;
         }
@@ -39,6 +43,7 @@ namespace wowgm::threading {
     private:
         void ThreadWorker(std::future<void> startFuture, std::future<void> future);
 
+        std::mutex _updatablesLock;
         std::vector<std::shared_ptr<Updatable>> _updatables;
 
         std::promise<void> _startPromise;
@@ -0,0 +1,353 @@
+#include "Benchmarks.hpp"
+#include "MovementEngine.hpp"
+#include "ObjectGuid.hpp"
+#include "DBIndexes.hpp"
+#include "DBC.hpp"
+#include "Utils.hpp"
+
+#include <shared/filesystem/mpq_file_loader.hpp>
+#include <shared/filesystem/mpq_file_system.hpp>
+
+#include <extstd/containers/flat_hash_map.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+namespace wowgm::utilities::benchmarks
+{
+    using namespace wowgm::game::structures;
+    using namespace wowgm::game::datastores;
+
+    namespace
+    {
+        using clock = std::chrono::steady_clock;
+
+        template <typename F>
+        double MeasureNanosecondsPerOperation(size_t operationCount, F&& f)
+        {
+            auto start = clock::now();
+            f();
+            auto elapsed = std::chrono::duration<double, std::nano>(clock::now() - start);
+            return elapsed.count() / double(operationCount);
+        }
+
+        struct HashMapTimings
+        {
+            double Insert;
+            double LookupHit;
+            double LookupMiss;
+        };
+
+        template <typename Map, typename K>
+        HashMapTimings MeasureHashMap(std::vector<K> const& keys, std::vector<K> const& missingKeys)
+        {
+            HashMapTimings timings;
+            Map map;
+
+            timings.Insert = MeasureNanosecondsPerOperation(keys.size(), [&]() {
+                for (K const& key : keys)
+                    map[key] = uint32_t(keys.size());
+            });
+
+            // Accumulate so that lookups cannot be optimized out.
+            volatile uint64_t sink = 0;
+            timings.LookupHit = MeasureNanosecondsPerOperation(keys.size(), [&]() {
+                uint64_t sum = 0;
+                for (K const& key : keys)
+                    sum += map.find(key)->second;
+                sink = sum;
+            });
+
+            timings.LookupMiss = MeasureNanosecondsPerOperation(missingKeys.size(), [&]() {
+                uint64_t misses = 0;
+                for (K const& key : missingKeys)
+                    misses += map.find(key) == map.end();
+                sink = misses;
+            });
+
+            return timings;
+        }
+
+        template <typename K>
+        void CompareHashMaps(std::ostream& output, char const* keyKind, std::vector<K> keys, std::vector<K> missingKeys)
+        {
+            // Look up in a different order than insertion, like the game does.
+            std::shuffle(keys.begin(), keys.end(), std::mt19937(0x5EED));
+
+            HashMapTimings flat = MeasureHashMap<extstd::containers::flat_hash_map<K, uint32_t>>(keys, missingKeys);
+            HashMapTimings node = MeasureHashMap<std::unordered_map<K, uint32_t>>(keys, missingKeys);
+
+            output << keyKind << " keys (" << keys.size() << "), ns/op, flat_hash_map vs unordered_map:" << std::endl;
+            output << "    insert:      " << flat.Insert << " vs " << node.Insert << std::endl;
+            output << "    lookup hit:  " << flat.LookupHit << " vs " << node.LookupHit << std::endl;
+            output << "    lookup miss: " << flat.LookupMiss << " vs " << node.LookupMiss << std::endl;
+        }
+    }
+
+    void RunMovement(std::ostream& output, size_t unitCount)
+    {
+        using namespace std::chrono;
+
+        std::vector<microseconds> ticks = wowgm::game::movement::MovementEngine::RunBenchmark(unitCount, 1000);
+        std::sort(ticks.begin(), ticks.end());
+
+        microseconds total(0);
+        for (microseconds tick : ticks)
+            total += tick;
+
+        output << unitCount << " moving units, " << ticks.size() << " ticks: "
+            << "mean " << (total.count() / ticks.size()) << " us, "
+            << "p99 " << ticks[ticks.size() * 99 / 100].count() << " us, "
+            << "max " << ticks.back().count() << " us" << std::endl;
+    }
+
+    void RunHashMap(std::ostream& output, size_t keyCount)
+    {
+        // Record IDs are dense and sequential.
+        std::vector<uint32_t> ids(keyCount);
+        std::vector<uint32_t> missingIds(keyCount);
+        for (size_t i = 0; i < keyCount; ++i)
+        {
+            ids[i] = uint32_t(i + 1);
+            missingIds[i] = uint32_t(keyCount + i + 1);
+        }
+
+        CompareHashMaps(output, "Record ID", std::move(ids), std::move(missingIds));
+
+        // Creature GUIDs share their high part and spread their entries; counters are sequential.
+        std::mt19937 generator(0x5EED);
+        std::uniform_int_distribution<uint32_t> entries(1, 60000);
+
+        std::vector<ObjectGuid> guids;
+        std::vector<ObjectGuid> missingGuids;
+        guids.reserve(keyCount);
+        missingGuids.reserve(keyCount);
+        for (size_t i = 0; i < keyCount; ++i)
+        {
+            guids.emplace_back(HighGuid::Unit, entries(generator), uint32_t(i + 1));
+            missingGuids.emplace_back(HighGuid::Unit, entries(generator), uint32_t(keyCount + i + 1));
+        }
+
+        CompareHashMaps(output, "ObjectGuid", std::move(guids), std::move(missingGuids));
+    }
+
+    void RunColumnScan(std::ostream& output, size_t rowCount)
+    {
+        using level_type = ItemSparseColumns::value_type<11>;
+        using quality_type = ItemSparseColumns::value_type<1>;
+
+        // Item levels and qualities roughly follow the shipped table: mostly low, a long tail of epics.
+        std::mt19937 generator(0x5EED);
+        std::uniform_int_distribution<uint32_t> levels(1, 400);
+        std::discrete_distribution<uint32_t> qualities({ 10, 35, 30, 15, 8, 1, 1 });
+
+        std::vector<ItemSparseEntry> records(rowCount);
+        for (size_t i = 0; i < rowCount; ++i)
+        {
+            records[i].ID = uint32_t(i + 1);
+            records[i].ItemLevel = levels(generator);
+            records[i].Quality = qualities(generator);
+            records[i].InventoryType = uint32_t(i % 28);
+        }
+
+        level_type const minLevel = 200;
+        level_type const maxLevel = 300;
+        quality_type const minQuality = 4;
+
+        ItemSparseColumns columns;
+        double build = MeasureNanosecondsPerOperation(rowCount, [&]() {
+            columns.Build(records.data(), uint32_t(records.size()));
+        });
+
+        size_t rowMatches = 0;
+        double rowScan = MeasureNanosecondsPerOperation(rowCount, [&]() {
+            for (ItemSparseEntry const& record : records)
+                rowMatches += level_type(record.ItemLevel) >= minLevel && level_type(record.ItemLevel) <= maxLevel
+                    && quality_type(record.Quality) >= minQuality;
+        });
+
+        size_t columnMatches = 0;
+        double columnScan = MeasureNanosecondsPerOperation(rowCount, [&]() {
+            ColumnSelection selection = columns.SelectAll();
+            columns.Filter<11>(selection, minLevel, maxLevel);
+            columns.Filter<1>(selection, minQuality, std::numeric_limits<quality_type>::max());
+            columnMatches = columns.Count(selection);
+        });
+
+        size_t gathered = 0;
+        double columnGather = MeasureNanosecondsPerOperation(rowCount, [&]() {
+            ColumnSelection selection = columns.SelectAll();
+            columns.Filter<11>(selection, minLevel, maxLevel);
+            columns.Filter<1>(selection, minQuality, std::numeric_limits<quality_type>::max());
+            gathered = columns.Gather(selection).size();
+        });
+
+        output << rowCount << " ItemSparse rows, " << rowMatches << " matching, ns/row:" << std::endl;
+        output << "    column build:         " << build << std::endl;
+        output << "    row-wise scan:        " << rowScan << std::endl;
+        output << "    columnar scan:        " << columnScan << std::endl;
+        output << "    columnar scan+gather: " << columnGather << std::endl;
+
+        if (columnMatches != rowMatches || gathered != rowMatches)
+            output << "    MISMATCH: columnar scan found " << columnMatches << ", gathered " << gathered << std::endl;
+    }
+
+    void RunDBDecode(std::ostream& output, std::string const& clientPath)
+    {
+        shared::filesystem::mpq_file_system::Instance()->Initialize(clientPath);
+
+        shared::filesystem::mpq_index_statistics index = shared::filesystem::mpq_file_system::Instance()->GetIndexStatistics();
+        output << "MPQ index: " << index.fileCount << " files in " << index.archiveCount << " archives ("
+            << index.unlistedArchiveCount << " without listfile), built in " << index.buildTime.count() / 1000.0 << " ms, "
+            << index.memoryUsage / 1024 << " KB" << std::endl;
+
+        DataStores::BenchmarkDecoders(output, 20);
+    }
+
+    void RunDataStores(std::ostream& output, size_t recordCount)
+    {
+        DataStores::BenchmarkSyntheticTables(output, uint32_t(std::min<size_t>(recordCount, std::numeric_limits<uint32_t>::max() / 2)));
+    }
+
+    void RunMPQReads(std::ostream& output, std::string const& clientPath)
+    {
+        using shared::filesystem::mpq_cache_policy;
+        using shared::filesystem::mpq_file_system;
+
+        mpq_file_system* fileSystem = mpq_file_system::Instance();
+        fileSystem->Initialize(clientPath);
+
+        // Client databases are many small files, like most of what asset loading reads.
+        std::vector<std::string> fileNames;
+        for (std::string& fileName : fileSystem->GetFileNames())
+            if (fileName.compare(0, 14, "DBFILESCLIENT\\") == 0)
+                fileNames.push_back(std::move(fileName));
+
+        if (fileNames.empty())
+        {
+            output << "No DBFilesClient files found under " << clientPath << std::endl;
+            return;
+        }
+
+        auto readAll = [&](size_t threadCount, mpq_cache_policy cachePolicy) {
+            std::atomic<size_t> nextFile(0);
+            std::atomic<size_t> byteCount(0);
+
+            std::vector<std::thread> threads;
+            for (size_t i = 0; i < threadCount; ++i)
+            {
+                threads.emplace_back([&]() {
+                    for (size_t j = nextFile++; j < fileNames.size(); j = nextFile++)
+                        if (auto file = fileSystem->OpenFile(fileNames[j], cachePolicy))
+                            byteCount += file->GetFileSize();
+                });
+            }
+
+            for (std::thread& thread : threads)
+                thread.join();
+
+            return byteCount.load();
+        };
+
+        size_t maxThreads = std::max(1u, std::thread::hardware_concurrency());
+
+        double baseline = 0.0;
+        for (size_t threadCount = 1; ; threadCount = std::min(threadCount * 2, maxThreads))
+        {
+            fileSystem->SetMaxReaders(threadCount);
+
+            // The first pass opens the extra archive handles and warms the disk cache.
+            size_t peakBefore = wowgm::utilities::GetPeakResidentSetSize();
+            readAll(threadCount, mpq_cache_policy::bypass);
+            size_t peakAfter = wowgm::utilities::GetPeakResidentSetSize();
+
+            size_t byteCount = 0;
+            double seconds = MeasureNanosecondsPerOperation(1, [&]() {
+                byteCount = readAll(threadCount, mpq_cache_policy::bypass);
+            }) / 1.0e9;
+
+            double filesPerSecond = fileNames.size() / seconds;
+            if (threadCount == 1)
+                baseline = filesPerSecond;
+
+            output << threadCount << " readers: " << fileNames.size() << " files, " << byteCount / (1024.0 * 1024.0) << " MB in "
+                << seconds * 1000.0 << " ms, " << filesPerSecond << " files/s, x" << filesPerSecond / baseline
+                << ", peak RSS +" << (peakAfter - std::min(peakBefore, peakAfter)) / 1024 << " KB" << std::endl;
+
+            if (threadCount == maxThreads)
+                break;
+        }
+
+        fileSystem->SetMaxReaders(1);
+
+        // The passes above bypassed the cache, so it is still empty. The second pass only hits if every file fits in the budget.
+        for (size_t pass = 1; pass <= 2; ++pass)
+        {
+            shared::filesystem::mpq_cache_statistics before = fileSystem->GetCacheStatistics();
+            double seconds = MeasureNanosecondsPerOperation(1, [&]() {
+                readAll(1, mpq_cache_policy::use);
+            }) / 1.0e9;
+            shared::filesystem::mpq_cache_statistics after = fileSystem->GetCacheStatistics();
+
+            size_t hitCount = after.hitCount - before.hitCount;
+            size_t lookupCount = hitCount + after.missCount - before.missCount;
+
+            output << "cached pass " << pass << ": " << fileNames.size() / seconds << " files/s, hit rate "
+                << (lookupCount != 0 ? hitCount * 100.0 / lookupCount : 0.0) << "%, " << after.evictionCount - before.evictionCount
+                << " evictions, " << after.fileCount << " files / " << after.byteCount / 1024 << " KB held of "
+                << after.budget / 1024 << " KB" << std::endl;
+        }
+
+        // Headers only, through streams that decompress just the first sector. The cache is emptied first, or the streams would read from it.
+        fileSystem->SetCacheBudget(0);
+        fileSystem->SetCacheBudget(mpq_file_system::DefaultCacheBudget);
+
+        size_t headerCount = 0;
+        double seconds = MeasureNanosecondsPerOperation(1, [&]() {
+            uint8_t header[20];
+            for (std::string const& fileName : fileNames)
+                if (auto stream = fileSystem->OpenStream(fileName))
+                    headerCount += stream->ReadBytes(0, sizeof(header), header, sizeof(header)) == sizeof(header);
+        }) / 1.0e9;
+
+        output << "streamed headers: " << headerCount << " of " << fileNames.size() << " files, " << fileNames.size() / seconds << " files/s" << std::endl;
+
+        // Everything queued at once on the background loader, in random priority order, with every tenth file asked for twice.
+        fileSystem->SetCacheBudget(0);
+        fileSystem->SetCacheBudget(mpq_file_system::DefaultCacheBudget);
+
+        fileSystem->SetMaxReaders(maxThreads);
+        shared::filesystem::mpq_file_loader loader(*fileSystem, maxThreads);
+
+        std::mt19937 generator(42);
+        std::uniform_real_distribution<float> priorities(0.0f, 1.0f);
+
+        std::vector<shared::filesystem::mpq_load_request> requests;
+        seconds = MeasureNanosecondsPerOperation(1, [&]() {
+            for (size_t i = 0; i < fileNames.size(); ++i)
+            {
+                requests.push_back(loader.Load(fileNames[i], priorities(generator)));
+                if (i % 10 == 0)
+                    requests.push_back(loader.Load(fileNames[i], priorities(generator)));
+            }
+
+            for (shared::filesystem::mpq_load_request const& request : requests)
+                request.GetFuture().wait();
+        }) / 1.0e9;
+
+        shared::filesystem::mpq_loader_statistics loads = loader.GetStatistics();
+        output << "background loader: " << requests.size() << " requests, " << loads.completedCount << " loads, "
+            << loads.coalescedCount << " coalesced, " << requests.size() / seconds << " requests/s, latency p50 "
+            << loads.latencyP50.count() / 1000.0 << " ms, p90 " << loads.latencyP90.count() / 1000.0 << " ms, p99 "
+            << loads.latencyP99.count() / 1000.0 << " ms" << std::endl;
+
+        fileSystem->SetMaxReaders(1);
+    }
+}
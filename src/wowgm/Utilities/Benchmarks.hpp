@@ -0,0 +1,26 @@
+#pragma once
+
+#include <cstddef>
+#include <ostream>
+#include <string>
+
+namespace wowgm::utilities::benchmarks
+{
+    /// Times movement extrapolation ticks for {@param unitCount} synthetic moving units.
+    void RunMovement(std::ostream& output, size_t unitCount);
+
+    /// Compares insert and lookup throughput of extstd::containers::flat_hash_map against std::unordered_map.
+    void RunHashMap(std::ostream& output, size_t keyCount);
+
+    /// Compares a row-wise predicate scan over {@param rowCount} synthetic ItemSparse records against the columnar one.
+    void RunColumnScan(std::ostream& output, size_t rowCount);
+
+    /// Reports the MPQ file index of the client found at {@param clientPath}, then times the per-table DBC record decoders against it.
+    void RunDBDecode(std::ostream& output, std::string const& clientPath);
+
+    /// Loads every table from synthetic files of {@param recordCount} records and writes per-table load and lookup costs as JSON.
+    void RunDataStores(std::ostream& output, size_t recordCount);
+
+    /// Reads every client database of the client found at {@param clientPath} with 1 to N concurrent MPQ readers, then twice through the file cache, then only their headers through streams, then all of them through the background loader.
+    void RunMPQReads(std::ostream& output, std::string const& clientPath);
+}
@@ -10,6 +10,8 @@ profiler_manager* profiler_manager::instance()
 
 void profiler_manager::report(std::string&& str, std::chrono::microseconds ns)
 {
+    std::lock_guard<std::mutex> lock(_timersLock);
+
     profiler_map::iterator data = _timers.find(str);
 
     auto nsc = ns.count();
@@ -4,7 +4,8 @@
 #include <memory>
 #include <string>
 #include <algorithm>
-#include <unordered_map>
+#include <mutex>
+#include <extstd/containers/flat_hash_map.hpp>
 #include <boost/current_function.hpp>
 #include <iostream>
 
@@ -27,7 +28,8 @@ public:
 
 private:
 
-    std::unordered_map<std::string, data_node> _timers;
+    std::mutex _timersLock;
+    extstd::containers::flat_hash_map<std::string, data_node> _timers;
     typedef decltype(_timers) profiler_map;
 };
 
@@ -4,6 +4,15 @@
 
 #include <sstream>
 
+#if PLATFORM == PLATFORM_WINDOWS
+# define WIN32_LEAN_AND_MEAN
+# include <Windows.h>
+# include <Psapi.h>
+# undef WIN32_LEAN_AND_MEAN
+#else
+# include <sys/resource.h>
+#endif
+
 #if PLATFORM == PLATFORM_WINDOWS
 struct tm* localtime_r(const time_t* time, struct tm *result)
 {
@@ -37,4 +46,25 @@ namespace wowgm::utilities
 
         return ss.str();
     }
+
+    size_t GetPeakResidentSetSize()
+    {
+#if PLATFORM == PLATFORM_WINDOWS
+        PROCESS_MEMORY_COUNTERS counters;
+        if (GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters)))
+            return counters.PeakWorkingSetSize;
+        return 0;
+#else
+        rusage usage;
+        if (getrusage(RUSAGE_SELF, &usage) != 0)
+            return 0;
+
+# if PLATFORM == PLATFORM_APPLE
+        return size_t(usage.ru_maxrss);
+# else
+        // Linux reports kilobytes.
+        return size_t(usage.ru_maxrss) * 1024u;
+# endif
+#endif
+    }
 }
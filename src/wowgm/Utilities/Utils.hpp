@@ -2,6 +2,7 @@
 
 #include <ctime>
 #include <string>
+#include <cstddef>
 #include <cstdint>
 #include <type_traits>
 
@@ -10,4 +11,7 @@ struct tm* localtime_r(const time_t* time, struct tm *result);
 namespace wowgm::utilities
 {
     std::string ByteArrayToHexStr(uint8_t const* bytes, uint32_t arrayLen, bool reverse = false);
+
+    /// Largest resident set of the process so far, in bytes. Returns 0 where the platform does not report it.
+    size_t GetPeakResidentSetSize();
 }
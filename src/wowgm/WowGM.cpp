@@ -18,6 +18,10 @@
 #include <shared/defines.hpp>
 
 #include "Presence.hpp"
+#include "ObjectUpdateBatch.hpp"
+#include "MovementEngine.hpp"
+#include "Benchmarks.hpp"
+#include "Updater.hpp"
 
 #include "Window.hpp"
 
@@ -32,7 +36,14 @@ int main(int argc, char* argv[])
         po::options_description desc("Allowed options");
         desc.add_options()
             ("help,h", "Print this help message.")
-            ("server,s", po::value<std::string>()->default_value("127.0.0.1"), "The address of the server to connect to.");
+            ("server,s", po::value<std::string>()->default_value("127.0.0.1"), "The address of the server to connect to.")
+            ("parallel-updates", po::value<uint32_t>()->default_value(0), "Apply object update packets with at least this many blocks on a worker pool (0 disables).")
+            ("benchmark-movement", po::value<uint32_t>(), "Measure movement extrapolation ticks for this many moving units, then exit.")
+            ("benchmark-hash-map", po::value<uint32_t>(), "Compare hash map insert and lookup throughput for this many keys, then exit.")
+            ("benchmark-column-scan", po::value<uint32_t>(), "Compare row-wise and columnar predicate scans over this many DBC records, then exit.")
+            ("benchmark-db-decode", po::value<std::string>(), "Time DBC record decoding per table for the client at this path, then exit.")
+            ("benchmark-datastores", po::value<uint32_t>(), "Load every DBC from synthetic files of this many records, print load and lookup costs as JSON, then exit.")
+            ("benchmark-mpq-reads", po::value<std::string>(), "Measure MPQ read throughput with one to all cores reading the client at this path, then exit.");
 
         po::variables_map mapped_values;
         po::store(po::parse_command_line(argc, argv, desc), mapped_values);
@@ -63,6 +74,42 @@ int main(int argc, char* argv[])
             return 0;
         }
 
+        if (mapped_values.count("benchmark-movement") != 0)
+        {
+            wowgm::utilities::benchmarks::RunMovement(std::cout, mapped_values["benchmark-movement"].as<uint32_t>());
+            return 0;
+        }
+
+        if (mapped_values.count("benchmark-hash-map") != 0)
+        {
+            wowgm::utilities::benchmarks::RunHashMap(std::cout, mapped_values["benchmark-hash-map"].as<uint32_t>());
+            return 0;
+        }
+
+        if (mapped_values.count("benchmark-column-scan") != 0)
+        {
+            wowgm::utilities::benchmarks::RunColumnScan(std::cout, mapped_values["benchmark-column-scan"].as<uint32_t>());
+            return 0;
+        }
+
+        if (mapped_values.count("benchmark-db-decode") != 0)
+        {
+            wowgm::utilities::benchmarks::RunDBDecode(std::cout, mapped_values["benchmark-db-decode"].as<std::string>());
+            return 0;
+        }
+
+        if (mapped_values.count("benchmark-datastores") != 0)
+        {
+            wowgm::utilities::benchmarks::RunDataStores(std::cout, mapped_values["benchmark-datastores"].as<uint32_t>());
+            return 0;
+        }
+
+        if (mapped_values.count("benchmark-mpq-reads") != 0)
+        {
+            wowgm::utilities::benchmarks::RunMPQReads(std::cout, mapped_values["benchmark-mpq-reads"].as<std::string>());
+            return 0;
+        }
+
         std::cout << std::endl;
         std::cout << "`7MMF'     A     `7MF'                              .g8\"\"\"bgd  `7MMM.     ,MMF'" << std::endl;
         std::cout << "  `MA     ,MA     ,V                              .dP'     `M    MMMb    dPMM" << std::endl;
@@ -75,9 +122,16 @@ int main(int argc, char* argv[])
 
         auto authserver = mapped_values["server"].as<std::string>();
 
+        wowgm::game::entities::ObjectUpdateBatch::SetParallelThreshold(mapped_values["parallel-updates"].as<uint32_t>());
+
+        wowgm::game::movement::MovementEngine::Initialize();
+        sUpdater->Start();
+
         wowgm::Window window(1800, 768, "WowGM");
         window.runWindowLoop([&window]() {
         });
+
+        sUpdater->Stop();
     }
     catch (const boost::system::system_error& se)
     {